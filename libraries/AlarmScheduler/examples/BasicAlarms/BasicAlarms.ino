@@ -10,6 +10,8 @@
  * - Day mask usage
  * - SPIFFS integration
  * - Debug output
+ * - Tickless loop with msUntilNextDue(), woken early by edits posted from
+ *   other tasks (setCommandNotify)
  * 
  * @note Requires:
  *       - ESP32 board
@@ -38,6 +40,16 @@ const int DAYLIGHT_OFFSET_SEC = 3600;  // DST +1 hour
 // Create scheduler instance
 AlarmScheduler scheduler;
 
+// Task running setup() and loop(), woken when another task posts an edit
+TaskHandle_t loopTask = nullptr;
+
+/**
+ * @brief Command notify hook: runs on the posting task
+ */
+void wakeLoop() {
+    xTaskNotifyGive(loopTask);
+}
+
 // ============================================================================
 // ALARM CALLBACK FUNCTIONS
 // ============================================================================
@@ -102,6 +114,10 @@ void intervalCheck(uint16_t checkType) {
 // ============================================================================
 
 void setup() {
+    // Posts from other tasks (e.g. a web server) wake loop() out of its sleep
+    loopTask = xTaskGetCurrentTaskHandle();
+    scheduler.setCommandNotify(wakeLoop);
+    
     Serial.begin(115200);
     delay(1000);
     
@@ -273,5 +289,8 @@ void loop() {
         lastPrint = millis();
     }
     
-    delay(1000);  // Check every second
+    // Sleep until the next alarm is due instead of polling every second
+    // (capped so the status line above keeps printing); a posted edit ends it
+    uint32_t waitMs = scheduler.msUntilNextDue();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs < 30000 ? waitMs : 30000));
 }
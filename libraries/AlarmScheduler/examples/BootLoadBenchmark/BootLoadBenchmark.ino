@@ -0,0 +1,104 @@
+/**
+ * @file BootLoadBenchmark.ino
+ * @brief Boot-time load of customizable alarms: binary store vs JSON file
+ *
+ * This example shows:
+ * - Filling 16, 64 and 256 customizable alarms and saving them in both formats
+ * - Time taken by loadCustomizables() (binary, CRC-checked) and by
+ *   loadCustomizablesFromJSON() (streamed, one element at a time)
+ * - File size of each format
+ *
+ * @note Requires:
+ *       - ESP32 board
+ *       - ArduinoJson library
+ *       - SPIFFS partition
+ *
+ * @warning Deletes the saved customizable alarms and overwrites
+ *          /customizable_alarms.json.
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ */
+
+#include <SPIFFS.h>
+#include <AlarmScheduler.h>
+
+const int RUNS = 10;    // loads averaged per format
+
+void onAlarm(uint16_t param) {
+}
+
+/**
+ * @brief Size of a SPIFFS file in bytes (0 if missing)
+ * @param path File path
+ */
+size_t fileSize(const char* path) {
+    File f = SPIFFS.open(path, "r");
+    size_t size = f ? f.size() : 0;
+    f.close();
+    return size;
+}
+
+/**
+ * @brief Save N alarms in both formats and time loading each one
+ * @tparam N      Number of customizable alarms
+ * @tparam IndexT Index type able to hold N + 1 slots
+ */
+template <size_t N, typename IndexT>
+void runBenchmark() {
+    typedef BasicAlarmScheduler<N + 1, IndexT> Scheduler;
+    Scheduler* scheduler = new Scheduler();    // 256 alarms do not fit on the loop() stack
+
+    // Start without snapshots, so the one saved below lands in slot A (BINARY_FILE)
+    SPIFFS.remove(Scheduler::BINARY_FILE);
+    SPIFFS.remove(Scheduler::BINARY_FILE_B);
+    SPIFFS.remove(Scheduler::JOURNAL_FILE);
+    
+    scheduler->clear();
+    char name[32];
+    for (size_t i = 0; i < N; i++) {
+        snprintf(name, sizeof(name), "Bell %u", (unsigned)i);
+        scheduler->addCustomizable(name, "Daily school bell", DOW_MONDAY | DOW_FRIDAY,
+                                   i % 24, i % 60, "BELL", i, onAlarm, true);
+    }
+    scheduler->flush();
+    scheduler->saveCustomizablesToJSON();
+
+    uint32_t t0 = micros();
+    for (int r = 0; r < RUNS; r++) scheduler->loadCustomizables();
+    uint32_t binaryUs = (micros() - t0) / RUNS;
+
+    t0 = micros();
+    for (int r = 0; r < RUNS; r++) scheduler->loadCustomizablesFromJSON();
+    uint32_t jsonUs = (micros() - t0) / RUNS;
+
+    Serial.printf("%6u | %9u us | %8u B | %9u us | %8u B\n",
+                  (unsigned)N, (unsigned)binaryUs, (unsigned)fileSize(Scheduler::BINARY_FILE),
+                  (unsigned)jsonUs, (unsigned)fileSize(Scheduler::JSON_FILE));
+
+    delete scheduler;
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n========================================");
+    Serial.println("  AlarmScheduler - Boot Load Benchmark");
+    Serial.println("========================================\n");
+
+    if (!SPIFFS.begin(true)) {
+        Serial.println("SPIFFS mount failed!");
+        return;
+    }
+
+    Serial.println("alarms |   binary    | bin size |    JSON     | JSON size");
+    Serial.println("-------+-------------+----------+-------------+----------");
+    runBenchmark<16, uint8_t>();
+    runBenchmark<64, uint8_t>();
+    runBenchmark<256, uint16_t>();
+}
+
+void loop() {
+    delay(1000);
+}
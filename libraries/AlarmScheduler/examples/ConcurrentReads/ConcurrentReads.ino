@@ -0,0 +1,161 @@
+/**
+ * @file ConcurrentReads.ino
+ * @brief Stress test of the JSON readers running on another task than the edits
+ *
+ * This example shows:
+ * - An editing task that posts adds, modifies, enables and deletes of customizable
+ *   alarms as fast as it can; check() applies them, moving the string arena on
+ *   every edit
+ * - loop() calling check() on the Arduino core, the only task changing the table
+ * - A reader task on the other core exporting the list, the delta feed and the
+ *   statistics, checking every alarm for fields that do not belong together
+ *
+ * Each alarm encodes its parameter in every field (name "N<p>", description
+ * "D<p>", hour p % 24, minute p % 60), so a torn read shows up as an element
+ * whose fields disagree. The report every 5 s should always say torn=0;
+ * refused counts posts to a full queue.
+ *
+ * @note Requires:
+ *       - ESP32 board (two cores)
+ *       - ArduinoJson library
+ *       - SPIFFS partition
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ */
+
+#include <SPIFFS.h>
+#include <AlarmScheduler.h>
+
+AlarmScheduler scheduler;
+
+volatile uint32_t edits = 0;
+volatile uint32_t refused = 0;
+volatile uint32_t reads = 0;
+volatile uint32_t torn = 0;
+uint32_t ticks = 0;
+
+void onAlarm(uint16_t param) {
+}
+
+/**
+ * @brief Name and description encoding a parameter, of varying length
+ * @param p           Parameter
+ * @param name        Output buffer (32 bytes)
+ * @param description Output buffer (64 bytes)
+ */
+void encode(uint16_t p, char* name, char* description) {
+    int pad = 1 + p % 7;
+    snprintf(name, 32, "N%u%.*s", p, pad, "xxxxxxx");
+    snprintf(description, 64, "D%u%.*s", p, 3 * pad, "yyyyyyyyyyyyyyyyyyyyy");
+}
+
+/**
+ * @brief true if every field of an exported alarm matches its parameter
+ * @param alarm Element of "alarms" or "changed"
+ */
+bool consistent(JsonObject alarm) {
+    uint16_t p = alarm["parameter"] | 0;
+    char name[32], description[64];
+    encode(p, name, description);
+    return strcmp(alarm["name"] | "", name) == 0 &&
+           strcmp(alarm["description"] | "", description) == 0 &&
+           (alarm["hour"] | 99) == p % 24 &&
+           (alarm["minute"] | 99) == p % 60;
+}
+
+/**
+ * @brief Editing task: posts the edits, check() applies them on the loop task
+ */
+void editTask(void*) {
+    char name[32], description[64];
+    for (;;) {
+        uint32_t r = esp_random();
+        uint16_t p = r % 1000;
+        int webId = 1 + (r >> 16) % 64;    // unknown IDs are skipped by check()
+        encode(p, name, description);
+
+        bool posted;
+        switch ((r >> 8) % 4) {
+            case 0:
+                posted = (r & 0x1000)
+                    ? scheduler.postDeleteCustomizable(webId)
+                    : scheduler.postAddCustomizable(name, description, DOW_ALL, p % 24, p % 60, "TEST", p, onAlarm, true);
+                break;
+            case 1:
+                posted = scheduler.postEnableCustomizable(webId, r & 1);
+                break;
+            default:
+                posted = scheduler.postModifyCustomizable(webId, name, description, DOW_ALL, p % 24, p % 60, "TEST", true, onAlarm, p);
+                break;
+        }
+        if (posted) edits++; else refused++;
+        vTaskDelay(1);
+    }
+}
+
+/**
+ * @brief Reader task: what an async web server would do
+ */
+void readTask(void*) {
+    uint32_t since = 0;
+    JsonDocument doc;
+    for (;;) {
+        deserializeJson(doc, scheduler.getCustomizablesJSON());
+        JsonArray alarms = doc["alarms"].as<JsonArray>();
+        for (JsonObject alarm : alarms) {
+            if (!consistent(alarm)) torn++;
+        }
+        if ((doc["total"] | -1) != (int)alarms.size()) torn++;
+
+        deserializeJson(doc, scheduler.getChangesJSON(since));
+        for (JsonObject alarm : doc["changed"].as<JsonArray>()) {
+            if (!consistent(alarm)) torn++;
+        }
+        since = doc["dataVersion"] | 0;
+
+        deserializeJson(doc, scheduler.getStatisticsJSON());
+        if ((doc["system"] | 0) + (doc["customizable"] | 0) != (doc["totalAlarms"] | -1)) torn++;
+
+        reads++;
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n========================================");
+    Serial.println("  AlarmScheduler - Concurrent Reads");
+    Serial.println("========================================\n");
+
+    if (!SPIFFS.begin(true)) {
+        Serial.println("SPIFFS mount failed!");
+        return;
+    }
+
+    scheduler.begin(false);
+    scheduler.addExternal(DOW_ALL, 3, 0, 0, onAlarm, 0);
+
+    char name[32], description[64];
+    for (uint16_t p = 0; p < 10; p++) {
+        encode(p, name, description);
+        scheduler.addCustomizable(name, description, DOW_ALL, p % 24, p % 60, "TEST", p, onAlarm, true);
+    }
+
+    xTaskCreatePinnedToCore(editTask, "edit", 8192, nullptr, 1, nullptr, 1);
+    xTaskCreatePinnedToCore(readTask, "read", 8192, nullptr, 1, nullptr, 0);
+}
+
+void loop() {
+    scheduler.check();
+    ticks++;
+
+    static uint32_t lastReport = 0;
+    if (millis() - lastReport >= 5000) {
+        lastReport = millis();
+        Serial.printf("edits=%u refused=%u reads=%u ticks=%u torn=%u\n",
+                      (unsigned)edits, (unsigned)refused, (unsigned)reads, (unsigned)ticks, (unsigned)torn);
+    }
+    delay(1);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file JsonImportHeap.ino
+ * @brief Peak heap used by loadCustomizablesFromJSON() on a 200-alarm file
+ *
+ * This example shows:
+ * - Writing a 200-alarm JSON file in the format of saveCustomizablesToJSON()
+ * - Importing it once and measuring the heap low-water mark around the call
+ *
+ * The file is written line by line with printf so that building it does not
+ * lower the low-water mark first. The import runs before anything else has
+ * allocated, so the drop of ESP.getMinFreeHeap() is the peak heap taken by
+ * the import itself.
+ *
+ * @note Requires:
+ *       - ESP32 board
+ *       - ArduinoJson library
+ *       - SPIFFS partition
+ *
+ * @warning Overwrites /customizable_alarms.json.
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ */
+
+#include <SPIFFS.h>
+#include <AlarmScheduler.h>
+
+const int NUM_ALARMS = 200;
+
+BasicAlarmScheduler<256, uint16_t> scheduler;    // static storage, not heap
+
+/**
+ * @brief Write NUM_ALARMS customizable alarms to the JSON file
+ */
+void writeJsonFile() {
+    File f = SPIFFS.open(BasicAlarmScheduler<256, uint16_t>::JSON_FILE, "w");
+    f.printf("{\"version\":\"1.0\",\"timestamp\":0,\"total\":%d,\"alarms\":[", NUM_ALARMS);
+    for (int i = 0; i < NUM_ALARMS; i++) {
+        f.printf("%s{\"id\":%d,\"name\":\"Bell %d\",\"description\":\"Daily school bell\","
+                 "\"day\":%d,\"dayName\":\"\",\"hour\":%d,\"minute\":%d,\"action\":\"BELL\","
+                 "\"parameter\":%d,\"enabled\":true,\"timeText\":\"%02d:%02d\",\"arrayIndex\":%d}",
+                 i ? "," : "", i + 1, i, i % 8, i % 24, i % 60, i, i % 24, i % 60, i);
+    }
+    f.print("]}");
+    f.close();
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n========================================");
+    Serial.println("  AlarmScheduler - JSON Import Heap");
+    Serial.println("========================================\n");
+
+    if (!SPIFFS.begin(true)) {
+        Serial.println("SPIFFS mount failed!");
+        return;
+    }
+
+    writeJsonFile();
+
+    File f = SPIFFS.open(BasicAlarmScheduler<256, uint16_t>::JSON_FILE, "r");
+    Serial.printf("File size:      %u B\n", (unsigned)f.size());
+    f.close();
+
+    uint32_t freeBefore = ESP.getFreeHeap();
+    uint32_t minBefore  = ESP.getMinFreeHeap();
+    uint32_t t0 = micros();
+    bool ok = scheduler.loadCustomizablesFromJSON();
+    uint32_t elapsed = micros() - t0;
+    uint32_t minAfter = ESP.getMinFreeHeap();
+
+    Serial.printf("Imported:       %s, %u alarms in %u us\n",
+                  ok ? "yes" : "no", scheduler.count(), (unsigned)elapsed);
+    if (minAfter < minBefore) {
+        Serial.printf("Peak heap:      %u B\n", (unsigned)(freeBefore - minAfter));
+    } else {
+        Serial.println("Peak heap:      below previous low-water mark");
+    }
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file MemoryFootprint.ino
+ * @brief RAM footprint report for the AlarmScheduler alarm table
+ * 
+ * This example shows:
+ * - sizeof() of the hot (Alarm) and cold (AlarmInfo) alarm records
+ * - The previous single-struct layout, for comparison
+ * - Table sizes and bytes walked by the scheduler at 16, 64 and 256 alarms
+ * - Whole scheduler size, including the name/description string arena
+ * 
+ * @note Requires:
+ *       - ESP32 board
+ *       - ArduinoJson library
+ * 
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ */
+
+#include <AlarmScheduler.h>
+
+/**
+ * @brief Previous layout: scheduling fields and web metadata in one struct
+ */
+struct LegacyAlarm {
+    bool     enabled;
+    uint8_t  dayMask;
+    uint8_t  hour;
+    uint8_t  minute;
+    uint16_t intervalMin;
+    int16_t  lastYearDay;
+    uint8_t  lastMinute;
+    uint8_t  lastHour;
+    time_t   lastExecution;
+    void     (AlarmScheduler::*action)(uint16_t);
+    void     (*externalAction)(uint16_t);
+    void     (*externalAction0)();
+    uint16_t parameter;
+    char     name[50];
+    char     description[100];
+    char     typeString[20];
+    bool     isCustomizable;
+    int      webId;
+};
+
+/**
+ * @brief Print one row of the comparison table
+ * @param alarms    Number of alarms in the table
+ * @param scheduler sizeof() of the whole scheduler object for that capacity
+ */
+void printRow(size_t alarms, size_t scheduler) {
+    size_t legacy = alarms * sizeof(LegacyAlarm);
+    size_t hot    = alarms * sizeof(Alarm);
+    size_t cold   = alarms * sizeof(AlarmInfo);
+    
+    Serial.printf("%7u | %12u | %9u | %10u | %11u | %9u\n",
+                  (unsigned)alarms, (unsigned)legacy, (unsigned)hot, (unsigned)cold,
+                  (unsigned)(hot + cold), (unsigned)scheduler);
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+    
+    Serial.println("\n========================================");
+    Serial.println("  AlarmScheduler - Memory Footprint");
+    Serial.println("========================================\n");
+    
+    Serial.printf("sizeof(LegacyAlarm): %u bytes (single struct)\n", (unsigned)sizeof(LegacyAlarm));
+    Serial.printf("sizeof(Alarm):       %u bytes (hot, scanned by check())\n", (unsigned)sizeof(Alarm));
+    Serial.printf("sizeof(AlarmInfo):   %u bytes (cold, JSON/web only)\n\n", (unsigned)sizeof(AlarmInfo));
+    
+    Serial.println(" alarms | legacy table | hot table | cold table | split total | scheduler");
+    Serial.println("--------+--------------+-----------+------------+-------------+----------");
+    printRow(16,  sizeof(BasicAlarmScheduler<16>));
+    printRow(64,  sizeof(BasicAlarmScheduler<64>));
+    printRow(256, sizeof(BasicAlarmScheduler<256, uint16_t>));
+    
+    Serial.println("\n'hot table' is what check() walks; 'legacy table' is what it used to walk.");
+    Serial.println("'scheduler' includes the shared name/description arena (64 bytes per alarm by default).");
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file StreamingExport.ino
+ * @brief Serving the alarm list as a chunked HTTP response, without a String
+ *
+ * This example shows:
+ * - getCustomizablesJSON(Print&) written into a chunked WebServer response
+ *   through a small buffered Print (ChunkedResponse)
+ * - The peak heap of exporting 200 alarms into a String and into a Print
+ *
+ * The Print export serializes one alarm at a time, so its peak heap does not
+ * grow with the number of alarms; the String export holds the whole document
+ * and the whole text, which it keeps as a cache until the alarms change. The
+ * String export runs last: its peak lowers the low-water mark for anything
+ * measured after it.
+ *
+ * @note Requires:
+ *       - ESP32 board
+ *       - ArduinoJson library
+ *       - WiFi credentials (WIFI_SSID / WIFI_PASSWORD below)
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ */
+
+#include <WiFi.h>
+#include <WebServer.h>
+#include <AlarmScheduler.h>
+
+const char* WIFI_SSID     = "your-ssid";
+const char* WIFI_PASSWORD = "your-password";
+const int   NUM_ALARMS    = 200;
+
+typedef BasicAlarmScheduler<256, uint16_t, 4096> Scheduler;
+Scheduler scheduler;    // static storage, not heap
+WebServer server(80);
+
+void onAlarm(uint16_t param) {
+}
+
+/**
+ * @brief Print that sends what it receives as HTTP chunks of up to 256 bytes
+ */
+class ChunkedResponse : public Print {
+public:
+    /**
+     * @brief Start a chunked response (content length unknown)
+     * @param web         Server handling the current request
+     * @param contentType MIME type of the body
+     */
+    ChunkedResponse(WebServer& web, const char* contentType) : _server(web) {
+        _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        _server.send(200, contentType, "");
+    }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t length) override {
+        for (size_t i = 0; i < length; i++) {
+            if (_used == sizeof(_buffer)) _sendBuffer();
+            _buffer[_used++] = data[i];
+        }
+        return length;
+    }
+
+    /// @brief Send the buffered bytes and the final empty chunk
+    void end() {
+        _sendBuffer();
+        _server.sendContent("");
+    }
+
+private:
+    void _sendBuffer() {
+        if (_used > 0) _server.sendContent(_buffer, _used);
+        _used = 0;
+    }
+
+    WebServer& _server;
+    char       _buffer[256];
+    size_t     _used = 0;
+};
+
+/**
+ * @brief Print that only counts bytes (heap measurement)
+ */
+class CountingPrint : public Print {
+public:
+    size_t write(uint8_t c) override { count++; return 1; }
+    size_t write(const uint8_t* data, size_t length) override { count += length; return length; }
+    size_t count = 0;
+};
+
+void handleGetAlarms() {
+    ChunkedResponse response(server, "application/json");
+    scheduler.getCustomizablesJSON(response);
+    response.end();
+}
+
+void handleGetStats() {
+    ChunkedResponse response(server, "application/json");
+    scheduler.getStatisticsJSON(response);
+    response.end();
+}
+
+/**
+ * @brief Peak heap taken by one export, from the drop of the low-water mark
+ * @param label  Name printed in the report
+ * @param toPrint true for getCustomizablesJSON(Print&), false for the String version
+ */
+void measureExport(const char* label, bool toPrint) {
+    uint32_t freeBefore = ESP.getFreeHeap();
+    uint32_t minBefore  = ESP.getMinFreeHeap();
+    size_t   bytes;
+    if (toPrint) {
+        CountingPrint counter;
+        bytes = scheduler.getCustomizablesJSON(counter);
+    } else {
+        bytes = scheduler.getCustomizablesJSON().length();
+    }
+    uint32_t minAfter = ESP.getMinFreeHeap();
+
+    if (minAfter < minBefore) {
+        Serial.printf("%-7s %6u B  peak heap %6u B\n", label, (unsigned)bytes, (unsigned)(freeBefore - minAfter));
+    } else {
+        Serial.printf("%-7s %6u B  peak heap below previous low-water mark\n", label, (unsigned)bytes);
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n========================================");
+    Serial.println("  AlarmScheduler - Streaming Export");
+    Serial.println("========================================\n");
+
+    // Alarms in RAM only: nothing is written to flash
+    scheduler.setAutoSave(false);
+    char name[32];
+    for (int i = 0; i < NUM_ALARMS; i++) {
+        snprintf(name, sizeof(name), "Bell %d", i);
+        scheduler.addCustomizable(name, "", DOW_ALL, i % 24, i % 60, "BELL", i, onAlarm, true);
+    }
+
+    measureExport("Print", true);
+    measureExport("String", false);
+
+    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    while (WiFi.status() != WL_CONNECTED) {
+        delay(500);
+        Serial.print(".");
+    }
+    Serial.printf("\nhttp://%s/api/alarms\n", WiFi.localIP().toString().c_str());
+
+    server.on("/api/alarms", HTTP_GET, handleGetAlarms);
+    server.on("/api/stats", HTTP_GET, handleGetStats);
+    server.begin();
+}
+
+void loop() {
+    server.handleClient();
+}
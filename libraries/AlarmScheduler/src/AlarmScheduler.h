@@ -17,7 +17,10 @@
  *          - **WEB MANAGEMENT:** Creation, editing, deletion via web interface
  *          - **JSON PERSISTENCE:** Automatic storage in SPIFFS
  *          - **UNIQUE IDS:** Independent web identification system
- *          - **DYNAMIC CALLBACKS:** Action configuration from external code
+ *          - **DYNAMIC CALLBACKS:** Action configuration from external code, and a
+ *            registry of callbacks by type name (registerAction) that binds the
+ *            alarms loaded from storage; check() dispatches through a one-byte
+ *            action ID per alarm
  *          
  *          **SUPPORTED ALARM TYPES:**
  *          1. **Fixed schedule:** Specific day + exact hour + minute
@@ -30,17 +33,96 @@
  *          **WEB CUSTOMIZABLE ALARM MANAGEMENT:**
  *          - Dynamic creation with name, description and action type
  *          - Complete editing preserving configured callbacks
- *          - Safe deletion with automatic array reorganization
+ *          - Deletion without moving other alarms: indices stay valid, freed
+ *            slots are reused, and web IDs are found through a hash index
  *          - Individual enable/disable by web ID
- *          - JSON export for web interface (complete list + statistics)
- *          - Automatic persistence in /customizable_alarms.json
+ *          - JSON export for web interface (complete list + statistics), into a
+ *            String cached until the next change (shared by the reading tasks)
+ *            or streamed into a Print
+ *          - Change version and ETag (getVersion, getETag) for "not modified"
+ *            answers without serializing
+ *          - Delta feed (getChangesJSON): alarms changed or deleted since a
+ *            version, from a ring of the last ALARMSCHEDULER_CHANGE_LOG changes
+ *          - JSON readers may run on another task (async web server): edits
+ *            move a sequence counter and readers copy again when one overlapped
+ *            (seqlock), so neither side takes a lock that would stall check()
+ *          - Automatic persistence in a snapshot (packed binary records with
+ *            CRC-32) plus /customizable_alarms.log
+ *            (journal): each add, modify, delete or enable appends one small
+ *            CRC-checked entry, and loading replays the journal on the snapshot
+ *            whose sequence it starts with (an older journal is dropped)
+ *          - Compaction: once the journal reaches JOURNAL_COMPACT_BYTES, check()
+ *            rewrites the snapshot and removes the journal after the debounce
+ *            window (setAutoSave), or on flush(); a torn trailing entry from a
+ *            power cut is ignored and also triggers a new snapshot
+ *          - Snapshots alternate between two files (/customizable_alarms.bin and
+ *            /customizable_alarms_b.bin) with a sequence number: a save never
+ *            truncates the newest valid one, and loading reads both headers and
+ *            CRC-checks only the newest, falling back to the other if it is damaged
+ *          - /customizable_alarms.json is import/export only; begin() imports it
+ *            when no valid binary file exists
+ *          - All files go through an AlarmStorage backend (setStorage): SPIFFS
+ *            by default, LittleFS, NVS or RAM (AlarmStorage*.h)
+ *          - Per-alarm mode (setPersistence(PERSIST_PER_ALARM)), meant for NVS:
+ *            one record per alarm keyed by web ID plus an index of web IDs;
+ *            modify and enable rewrite only that alarm's record
  *          - Automatic loading at system startup
  *          - Unique web IDs independent of array index
  *          
  *          **DUPLICATE PREVENTION:**
  *          - Cache by year day (lastYearDay) for daily alarms
  *          - Cache by minute (lastMinute) for same-day alarms
- *          - Epoch timestamp (lastExecution) for interval alarms
+ *          
+ *          **INTERVAL ALARMS:**
+ *          - Fire on a fixed grid: anchor (hour:minute, wildcard = 0) + k * interval
+ *            in local wall-clock minutes, restarted every day so the anchor
+ *            itself always fires, even when the interval does not divide 24 h
+ *          - Next occurrence is computed arithmetically, so polling latency,
+ *            resetCache() or a reboot never shift the phase
+ *          - Masked-out days and times inside a DST gap are skipped
+ *          
+ *          **MEMORY LAYOUT:**
+ *          - Alarm: scheduling fields only, contiguous array walked by check()
+ *          - AlarmInfo: type, web ID and string offsets in a parallel cold table
+ *          - Names and descriptions share one compacting arena (no fixed 150 bytes
+ *            per slot); deleting or editing an alarm reclaims its space, and
+ *            loads shorten texts that do not fit instead of dropping the alarm
+ *          - get(idx) / getInfo(idx) return the two halves of the same alarm
+ *          
+ *          **NEXT-FIRE QUEUE:**
+ *          - Each enabled alarm keeps its absolute next candidate time (nextFire)
+ *          - Candidates are kept in a min-heap ordered by (nextFire, index)
+ *          - check() only evaluates alarms at the top of the heap that are due
+ *          - Due alarms still run in array order within the same check()
+ *          - Any alarm change marks the queue dirty; it is rebuilt on next check()
+ *          - Clock steps backwards (NTP correction) also force a rebuild
+ *          - msUntilNextDue() exposes the heap top so loop() can sleep until then
+ *          - The broken-down time t is converted (localtime_r) once per minute or
+ *            after a clock step; in between check() only reads time() and
+ *            updates t.tm_sec
+ * 
+ *          **DAY PLAN:**
+ *          - Fixed-time alarms (hour and minute set, no interval) are not queued
+ *            in the heap; they are compiled into today's plan, sorted by
+ *            (minute of day, index), on the first check() of each day and after
+ *            any change
+ *          - check() advances a cursor through the plan; an entry fires only in
+ *            its own minute, so no per-alarm dedup test is needed for them
+ *          - Wildcard and interval alarms stay in the heap
+ *          - msUntilNextDue() takes the earlier of the plan cursor and heap top
+ * 
+ *          **EXECUTION STATISTICS (ALARMSCHEDULER_STATS):**
+ *          - Per alarm: fire count, last and longest callback time, and lateness
+ *            from the minute boundary, in a side table (getStats, list JSON)
+ *          - Loop health in getStatisticsJSON(): histograms of check() time and
+ *            of alarms evaluated per call, longest gap between calls
+ * 
+ *          **BIT-SLICED MATCHER (ALARMSCHEDULER_BITSLICED):**
+ *          - Wildcard alarms without interval leave the heap; their enabled flag,
+ *            day mask, hour and minute are stored as bit-planes, 32 alarms per word
+ *          - Once per minute a few AND/XOR operations per word produce a bitmap of
+ *            the alarms due now, which feeds the normal dispatch loop
+ *          - msUntilNextDue() is then at most one minute while such alarms exist
  * 
  * @note **TIME CONFIGURATION:**
  *       - 24-hour format (0-23 for tm_hour)
@@ -50,16 +132,18 @@
  * @warning **CRITICAL DEPENDENCIES:**
  *          - time.h: System time functions (getLocalTime, time_t)
  *          - ArduinoJson.h: JSON serialization/deserialization for persistence
- *          - SPIFFS.h: File system for persistent storage
+ *          - SPIFFS.h: File system of the default storage backend (AlarmStorage.h)
  * 
  * @warning **LIMITATIONS:**
- *          - Maximum 16 simultaneous alarms total (system + customizable)
+ *          - Maximum 16 simultaneous alarms total (system + customizable) with the
+ *            AlarmScheduler typedef; BasicAlarmScheduler<N, IndexT> sets any capacity
  *          - Minimum resolution of 1 minute (no second support)
  *          - Cache not persistent (lost on reboot)
  *          - RTC verification required for operation
  *          - **SPIFFS:** Requires sufficient space for JSON file
  *          - **CALLBACKS:** Must be configured externally before creating alarms
- *          - **THREAD SAFETY:** Not thread-safe, use from main thread only
+ *          - **THREAD SAFETY:** JSON readers may run on any task; edits run on the
+ *            task that calls check(), or are posted to it with post*() (see README)
  * 
  * @author Julian Salas Bartolomé
  * @date 2025-11-29
@@ -72,9 +156,13 @@
 #define ALARMSCHEDULER_H
 
 #include <time.h>
+#include <sys/time.h>
+#include <limits>
+#include <atomic>
+#include <memory>
 #include <Arduino.h>
 #include <ArduinoJson.h>
-#include <SPIFFS.h>
+#include "AlarmStorage.h"
 
 // Debug configuration (uncomment to enable)
 // #define ALARMSCHEDULER_DEBUG
@@ -89,6 +177,33 @@
     #define DBG_ALM_PRINTF(fmt, ...)
 #endif
 
+// Bit-sliced matcher for wildcard alarms (uncomment to enable). Meant for tables
+// with hundreds of alarms; it changes the class layout, so define it for the
+// whole project (build flags), not in a single sketch file.
+// #define ALARMSCHEDULER_BITSLICED
+
+// Per-alarm execution statistics (uncomment to enable): fire count, callback
+// time and lateness, in a side table of 16 bytes per alarm. Like the matcher
+// above, define it for the whole project.
+// #define ALARMSCHEDULER_STATS
+
+// Changes kept for getChangesJSON(); a client further behind gets the full list
+#ifndef ALARMSCHEDULER_CHANGE_LOG
+#define ALARMSCHEDULER_CHANGE_LOG 16
+#endif
+
+// Entries of the action table: registered types plus each distinct callback
+// passed to add(), addExternal(), addExternal0() or addCustomizable(). A
+// callback's entry is freed when its last alarm is removed. Without this
+// define the table has one entry per alarm (Capacity); define it to cap it:
+// #define ALARMSCHEDULER_MAX_ACTIONS 16
+
+// Commands posted from other tasks (post*Customizable) waiting for check(); a
+// power of two. Each one holds a name and a description, about 190 bytes.
+#ifndef ALARMSCHEDULER_COMMAND_QUEUE
+#define ALARMSCHEDULER_COMMAND_QUEUE 4
+#endif
+
 // Day masks (bit0 = Sunday ... bit6 = Saturday)
 // Spanish names
 enum : uint8_t {
@@ -114,51 +229,136 @@ enum : uint8_t {
     DOW_ALL        = DOW_TODOS
 };
 
+// Persistence modes of customizable alarms (setPersistence)
+enum AlarmPersistence : uint8_t {
+    PERSIST_SNAPSHOT  = 0,   // snapshot plus journal (default)
+    PERSIST_PER_ALARM = 1,   // one record per alarm plus an index (NVS)
+};
+
 #define ALARMA_WILDCARD 255   // wildcard (*)
 #define ALARM_WILDCARD  255   // English alias
 
-class AlarmScheduler; // forward declaration
+template <size_t Capacity, typename IndexT, size_t StringBytes> class BasicAlarmScheduler; // forward declaration
 
 /**
- * @brief Alarm structure containing all alarm configuration and state
+ * @brief Scheduling data of one alarm (hot part, read by check())
+ * 
+ * @details Web metadata lives in AlarmInfo, in a parallel table, so the scheduler
+ *          walks a compact array. Fields are ordered largest first to avoid padding.
+ *          The callback is an entry of the scheduler's action table, referenced
+ *          by actionId; see registerAction().
  */
 struct Alarm {
-    bool     enabled             = false;                       // Alarm enabled state
-    uint8_t  dayMask             = DOW_ALL;                     // Day mask (bit0=Sunday ... bit6=Saturday)
-    uint8_t  hour                = 0;                           // Hour (0-23 or ALARM_WILDCARD)
-    uint8_t  minute              = 0;                           // Minute (0-59 or ALARM_WILDCARD)
+    time_t   lastExecution       = 0;                           // Last execution timestamp
+    time_t   nextFire            = 0;                           // Next candidate fire time (0 = never)
     uint16_t intervalMin         = 0;                           // Interval (minutes)
+    uint16_t parameter           = 0;                           // Action parameter  
     int16_t  lastYearDay         = -1;                          // Last year day
+    uint16_t actionId            = 0;                           // Action table entry (0 = no callback)
     uint8_t  lastMinute          = 255;                         // Last minute  
     uint8_t  lastHour            = 255;                         // Last executed hour (255 initial)
-    time_t   lastExecution       = 0;                           // Last execution timestamp
-    void     (AlarmScheduler::*action)(uint16_t) = nullptr;     // Member method
-    void     (*externalAction)(uint16_t) = nullptr;             // External function with parameter
-    void     (*externalAction0)() = nullptr;                    // External function without parameter
-    uint16_t parameter           = 0;                           // Action parameter  
+    uint8_t  dayMask             = DOW_ALL;                     // Day mask (bit0=Sunday ... bit6=Saturday)
+    uint8_t  hour                = 0;                           // Hour (0-23 or ALARM_WILDCARD)
+    uint8_t  minute              = 0;                           // Minute (0-59 or ALARM_WILDCARD)
+    bool     enabled             = false;                       // Alarm enabled state
+};
+
+/**
+ * @brief Web metadata of one alarm (cold part, only touched by JSON/web paths)
+ * 
+ * @details Name and description are stored in the scheduler's string arena;
+ *          only their offsets live here. Use getName() / getDescription().
+ */
+struct AlarmInfo {
+    static constexpr uint16_t NO_STRING = 0xFFFF;              // Offset of an empty string
     
-    // Fields for web customization
-    char     name[50];                                          // Descriptive name
-    char     description[100];                                  // Optional description  
+    uint16_t nameOffset        = NO_STRING;                     // Descriptive name (arena offset)
+    uint16_t descriptionOffset = NO_STRING;                     // Optional description (arena offset)
     char     typeString[20];                                    // Generic type string
     bool     isCustomizable;                                    // true = editable via web, false = system
     int      webId = -1;                                        // Unique ID for web interface (-1 if not applicable)  
     
-    // Constructor to initialize new fields
-    Alarm() : isCustomizable(false), webId(-1) {
-        name[0] = '\0';
-        description[0] = '\0';
+    AlarmInfo() : isCustomizable(false), webId(-1) {
         strcpy(typeString, "SYSTEM");
     }    
 };
 
+/**
+ * @brief Execution statistics of one alarm (ALARMSCHEDULER_STATS)
+ * 
+ * @details Kept in a side table next to the alarms and reset when the slot is
+ *          reused. Lateness is measured from the start of the minute the alarm
+ *          fired in, so it includes the callbacks that ran before it.
+ */
+struct AlarmStats {
+    uint32_t fires      = 0;                                    // Times the callback was dispatched
+    uint32_t lastMicros = 0;                                    // Duration of the last callback (us)
+    uint32_t maxMicros  = 0;                                    // Longest callback (us)
+    uint16_t lastLateMs = 0;                                    // Last dispatch, ms after the minute boundary
+    uint16_t maxLateMs  = 0;                                    // Latest dispatch (ms)
+};
+
 /**
  * @brief Advanced alarm scheduler class with web management support
+ * 
+ * @tparam Capacity Maximum number of alarms (system + customizable)
+ * @tparam IndexT   Unsigned type used for alarm indices; its maximum value is
+ *                  reserved as INVALID_INDEX, so it must be larger than Capacity
+ * @tparam StringBytes Size of the shared arena holding alarm names and
+ *                  descriptions (default 64 bytes per alarm, capped at 65534)
+ * 
+ * @note Use the AlarmScheduler typedef (16 alarms, uint8_t indices) unless a
+ *       different capacity is needed, e.g. BasicAlarmScheduler<4> for tiny
+ *       nodes or BasicAlarmScheduler<1024, uint16_t> for gateways.
  */
-class AlarmScheduler {
+template <size_t Capacity, typename IndexT = uint8_t,
+          size_t StringBytes = (Capacity * 64 < 65535) ? Capacity * 64 : 65534>
+class BasicAlarmScheduler {
+    static_assert(!std::numeric_limits<IndexT>::is_signed, "IndexT must be unsigned");
+    static_assert(Capacity > 0, "Capacity must be at least 1");
+    static_assert(Capacity < (size_t)std::numeric_limits<IndexT>::max(),
+                  "IndexT too small for Capacity (max value is reserved as INVALID_INDEX)");
+    static_assert(StringBytes < AlarmInfo::NO_STRING, "StringBytes must fit a uint16_t offset");
+    static_assert(ALARMSCHEDULER_COMMAND_QUEUE > 0 &&
+                  (ALARMSCHEDULER_COMMAND_QUEUE & (ALARMSCHEDULER_COMMAND_QUEUE - 1)) == 0,
+                  "ALARMSCHEDULER_COMMAND_QUEUE must be a power of two");
+
 public:
-    static constexpr uint8_t MAX_ALARMS = 16;
-    struct tm t;
+    typedef ::Alarm Alarm;
+    typedef IndexT  Index;
+    
+    /**
+     * @brief Reference to an alarm that detects deletion
+     * @details Indices are stable: deleting an alarm frees its slot without
+     *          moving the others. A freed slot is reused by a later add; the
+     *          generation tells a handle taken before the reuse from the new alarm.
+     */
+    struct Handle {
+        IndexT   index;
+        uint16_t generation;
+    };
+    
+    static constexpr size_t MAX_ALARMS    = Capacity;
+    static constexpr IndexT INVALID_INDEX = std::numeric_limits<IndexT>::max();
+    static constexpr uint32_t DEFAULT_SAVE_DEBOUNCE_MS = 2000;  // quiet time before an auto-save
+    static constexpr const char* BINARY_FILE   = "/customizable_alarms.bin";    // snapshot slot A
+    static constexpr const char* BINARY_FILE_B = "/customizable_alarms_b.bin";  // snapshot slot B
+    static constexpr const char* JOURNAL_FILE = "/customizable_alarms.log";  // edits since the snapshot
+    static constexpr size_t JOURNAL_COMPACT_BYTES = 4096;   // journal size that triggers a new snapshot
+    static constexpr const char* JSON_FILE   = "/customizable_alarms.json";  // import/export
+    static constexpr const char* RECORD_FILE_PREFIX = "/alarm_";      // per-alarm record: prefix + web ID
+    static constexpr const char* RECORD_INDEX_FILE  = "/alarm_index"; // per-alarm mode: web IDs in table order
+    static constexpr size_t MAX_NAME_LENGTH        = 49;    // longer names are truncated
+    static constexpr size_t MAX_DESCRIPTION_LENGTH = 99;    // longer descriptions are truncated
+#ifdef ALARMSCHEDULER_MAX_ACTIONS
+    static constexpr size_t MAX_ACTIONS   = ALARMSCHEDULER_MAX_ACTIONS;
+#else
+    static constexpr size_t MAX_ACTIONS   = Capacity;       // one callback per alarm
+#endif
+    static_assert(MAX_ACTIONS > 0 && MAX_ACTIONS < 65535, "MAX_ACTIONS must fit a uint16_t action ID");
+    static constexpr uint16_t NO_ACTION   = 0;              // Alarm::actionId without callback
+    static constexpr size_t ETAG_SIZE     = 36;             // "<bootId>-<version>[-<fires>]", quoted
+    struct tm t;                    // local time of the last check(), valid inside callbacks
 
     // ========================================================================
     // PUBLIC METHODS - Available in Spanish and English
@@ -168,37 +368,53 @@ public:
     bool begin(bool loadDefaults = false);
     void check();
     
-    // Add alarms (system alarms)
-    uint8_t add(uint8_t dayMask,
-                uint8_t hour,
-                uint8_t minute,
-                uint16_t intervalMin,
-                void (AlarmScheduler::*action)(uint16_t),
-                uint16_t parameter = 0,
-                bool enabled = true);
+    // Tickless support: milliseconds until check() has work to do
+    static constexpr uint32_t NO_ALARM_DUE = UINT32_MAX;
+    uint32_t msHastaProximaAlarma() const;
+    uint32_t msUntilNextDue() const;
+    
+    // Add alarms (system alarms) - return INVALID_INDEX when full (alarms or actions)
+    IndexT add(uint8_t dayMask,
+               uint8_t hour,
+               uint8_t minute,
+               uint16_t intervalMin,
+               void (BasicAlarmScheduler::*action)(uint16_t),
+               uint16_t parameter = 0,
+               bool enabled = true);
                 
-    uint8_t addExternal(uint8_t dayMask,
+    IndexT addExternal(uint8_t dayMask,
+                       uint8_t hour,
+                       uint8_t minute,
+                       uint16_t intervalMin,
+                       void (*ext)(uint16_t),
+                       uint16_t parameter = 0,
+                       bool enabled = true);      
+                        
+    IndexT addExternal0(uint8_t dayMask,
                         uint8_t hour,
                         uint8_t minute,
                         uint16_t intervalMin,
-                        void (*ext)(uint16_t),
-                        uint16_t parameter = 0,
-                        bool enabled = true);      
-                        
-    uint8_t addExternal0(uint8_t dayMask,
-                         uint8_t hour,
-                         uint8_t minute,
-                         uint16_t intervalMin,
-                         void (*ext0)(),
-                         bool enabled = true);
-    
-    // Alarm management
-    void disable(uint8_t idx);
-    void enable(uint8_t idx);
+                        void (*ext0)(),
+                        bool enabled = true);
+    
+    // Alarm management (indices stay valid until that alarm is deleted)
+    void disable(IndexT idx);
+    void enable(IndexT idx);
     void clear();
-    uint8_t count() const;
-    const Alarm* get(uint8_t idx) const;
-    Alarm* getMutable(uint8_t idx);
+    IndexT count() const;
+    IndexT slotEnd() const;                 // scan 0..slotEnd(), skipping get(i) == nullptr
+    Handle getHandle(IndexT idx) const;
+    IndexT resolve(Handle handle) const;    // INVALID_INDEX once the alarm is deleted
+    const Alarm* get(IndexT idx) const;
+    Alarm* getMutable(IndexT idx);
+    const AlarmInfo* getInfo(IndexT idx) const;
+    AlarmInfo* getInfoMutable(IndexT idx);
+    void notifyChanged(IndexT idx);         // after editing through getMutable() / getInfoMutable()
+    const char* getName(IndexT idx) const;
+    const char* getDescription(IndexT idx) const;
+#ifdef ALARMSCHEDULER_STATS
+    const AlarmStats* getStats(IndexT idx) const;
+#endif
     void resetCache();
     
     // ========================================================================
@@ -206,11 +422,11 @@ public:
     // GESTIÓN WEB DE ALARMAS PERSONALIZABLES
     // ========================================================================
     
-    // Spanish names
-    uint8_t addPersonalizable(const char* nombre, const char* descripcion,
-                              uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
-                              const char* tipoString, uint16_t parametro,
-                              void (*callback)(uint16_t), bool habilitada = true);
+    // Spanish names (addPersonalizable returns INVALID_INDEX when full)
+    IndexT addPersonalizable(const char* nombre, const char* descripcion,
+                             uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
+                             const char* tipoString, uint16_t parametro,
+                             void (*callback)(uint16_t), bool habilitada = true);
     
     bool modificarPersonalizable(int idWeb, const char* nombre, const char* descripcion,
                                  uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
@@ -219,16 +435,45 @@ public:
     
     bool eliminarPersonalizable(int idWeb);
     bool habilitarPersonalizable(int idWeb, bool estado);
+    
+    // From any task: queued and applied by the next check() (false if full)
+    bool encolarAltaPersonalizable(const char* nombre, const char* descripcion,
+                                   uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
+                                   const char* tipoString, uint16_t parametro,
+                                   void (*callback)(uint16_t), bool habilitada = true);
+    bool encolarModificacionPersonalizable(int idWeb, const char* nombre, const char* descripcion,
+                                           uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
+                                           const char* tipoString, bool habilitada,
+                                           void (*callback)(uint16_t), uint16_t parametro);
+    bool encolarEliminacionPersonalizable(int idWeb);
+    bool encolarHabilitacionPersonalizable(int idWeb, bool estado);
+    uint32_t comandosDescartados() const;   // posts refused because the queue was full
+    void configurarAvisoComando(void (*aviso)());   // run by each post, e.g. to wake loop()
+    
     String obtenerPersonalizablesJSON();
     String obtenerEstadisticasJSON();
+    size_t obtenerPersonalizablesJSON(Print& salida);
+    size_t obtenerEstadisticasJSON(Print& salida);
+    uint32_t obtenerVersion() const;
+    const char* obtenerETag(char* buffer, size_t size);   // buffer of ETAG_SIZE
+    String obtenerCambiosJSON(uint32_t desdeVersion);
+    size_t obtenerCambiosJSON(uint32_t desdeVersion, Print& salida);
+    bool registrarAccion(const char* tipo, void (*accion)(uint16_t));
+    bool cargarPersonalizables();
+    bool guardarPersonalizables();
     bool cargarPersonalizablesDesdeJSON();
     bool guardarPersonalizablesEnJSON();
+    bool guardarPendientes();
+    void configurarAutoGuardado(bool habilitado, uint32_t esperaMs = DEFAULT_SAVE_DEBOUNCE_MS);
+    bool hayCambiosPendientes() const;
+    void configurarAlmacenamiento(AlarmStorage& almacenamiento);
+    void configurarPersistencia(AlarmPersistence modo);
     
     // English aliases
-    uint8_t addCustomizable(const char* name, const char* description,
-                            uint8_t dayMask, uint8_t hour, uint8_t minute,
-                            const char* typeString, uint16_t parameter,
-                            void (*callback)(uint16_t), bool enabled = true);
+    IndexT addCustomizable(const char* name, const char* description,
+                           uint8_t dayMask, uint8_t hour, uint8_t minute,
+                           const char* typeString, uint16_t parameter,
+                           void (*callback)(uint16_t), bool enabled = true);
     
     bool modifyCustomizable(int webId, const char* name, const char* description,
                             uint8_t dayMask, uint8_t hour, uint8_t minute,
@@ -237,25 +482,414 @@ public:
     
     bool deleteCustomizable(int webId);
     bool enableCustomizable(int webId, bool state);
+    
+    bool postAddCustomizable(const char* name, const char* description,
+                             uint8_t dayMask, uint8_t hour, uint8_t minute,
+                             const char* typeString, uint16_t parameter,
+                             void (*callback)(uint16_t), bool enabled = true);
+    bool postModifyCustomizable(int webId, const char* name, const char* description,
+                                uint8_t dayMask, uint8_t hour, uint8_t minute,
+                                const char* typeString, bool enabled,
+                                void (*callback)(uint16_t), uint16_t parameter);
+    bool postDeleteCustomizable(int webId);
+    bool postEnableCustomizable(int webId, bool state);
+    uint32_t getDroppedCommands() const;
+    void setCommandNotify(void (*notify)());
+    
     String getCustomizablesJSON();
     String getStatisticsJSON();
+    size_t getCustomizablesJSON(Print& out);
+    size_t getStatisticsJSON(Print& out);
+    uint32_t getVersion() const;
+    const char* getETag(char* buffer, size_t size);
+    String getChangesJSON(uint32_t sinceVersion);
+    size_t getChangesJSON(uint32_t sinceVersion, Print& out);
+    bool registerAction(const char* type, void (*action)(uint16_t));
+    bool loadCustomizables();
+    bool saveCustomizables();
     bool loadCustomizablesFromJSON();
     bool saveCustomizablesToJSON();
+    bool flush();
+    void setAutoSave(bool enabled, uint32_t debounceMs = DEFAULT_SAVE_DEBOUNCE_MS);
+    bool hasPendingChanges() const;
+    void setStorage(AlarmStorage& storage);
+    void setPersistence(AlarmPersistence mode);
     
     // Debug
     void printAllAlarms();
 
 private:
-    Alarm  _alarms[MAX_ALARMS];
-    uint8_t _num = 0;
-    int     _nextWebId = 1;
+    // Binary store: header, then per alarm a fixed record followed by the
+    // name and description bytes (lengths in the record, no terminator).
+    // Version 1 files have no sequence field and a CRC of the payload only.
+    static constexpr uint32_t BINARY_MAGIC        = 0x424D4C41;  // "ALMB"
+    static constexpr uint16_t BINARY_VERSION      = 2;
+    static constexpr uint8_t  BINARY_FLAG_ENABLED = 0x01;
+    
+    struct __attribute__((packed)) BinaryHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t count;             // records that follow
+        uint32_t payloadBytes;      // bytes after the header
+        uint32_t crc;               // CRC-32 of sequence and payload
+        uint32_t sequence;          // higher is newer, across both slots
+    };
+    static constexpr size_t BINARY_HEADER_V1 = sizeof(BinaryHeader) - sizeof(uint32_t);
+    
+    struct __attribute__((packed)) BinaryRecord {
+        int32_t  webId;
+        uint16_t parameter;
+        uint16_t intervalMin;
+        uint8_t  dayMask;
+        uint8_t  hour;
+        uint8_t  minute;
+        uint8_t  flags;             // BINARY_FLAG_*
+        char     typeString[19];    // not terminated when 19 chars long
+        uint8_t  nameLength;
+        uint8_t  descriptionLength;
+    };
+    
+    // Journal: entries appended after the snapshot, each with its own CRC so a
+    // torn tail is detected. PUT carries a BinaryRecord plus strings (add or
+    // modify), DELETE and ENABLE a JournalState. Replaying is idempotent.
+    // BASE opens the file with the uint32 sequence of the snapshot it follows,
+    // so a journal left behind by a cut before its removal is not replayed on
+    // the newer snapshot that already holds it.
+    static constexpr uint8_t JOURNAL_PUT    = 1;
+    static constexpr uint8_t JOURNAL_DELETE = 2;
+    static constexpr uint8_t JOURNAL_ENABLE = 3;
+    static constexpr uint8_t JOURNAL_BASE   = 5;
+    static constexpr size_t  JOURNAL_MAX_PAYLOAD = sizeof(BinaryRecord) + MAX_NAME_LENGTH + MAX_DESCRIPTION_LENGTH;
+    
+    // Per-alarm mode reuses the journal framing: each record file holds one
+    // PUT entry, the index file one INDEX entry with the int32 web IDs
+    static constexpr uint8_t RECORD_INDEX       = 4;
+    static constexpr size_t  RECORD_PATH_LENGTH = 20;   // RECORD_FILE_PREFIX + int32 + terminator
+    
+    struct __attribute__((packed)) JournalEntry {
+        uint32_t crc;               // CRC-32 of op, length and payload
+        uint8_t  op;                // JOURNAL_*
+        uint16_t length;            // payload bytes that follow
+    };
+    
+    // Print that appends to a String: the String exports reuse the Print ones
+    class StringWriter : public Print {
+    public:
+        explicit StringWriter(String& text) : _text(text) {}
+        size_t write(uint8_t c) override {
+            return _text.concat((char)c) ? 1 : 0;
+        }
+        size_t write(const uint8_t* data, size_t length) override {
+            return _text.concat((const char*)data, length) ? length : 0;
+        }
+    private:
+        String& _text;
+    };
+    
+    struct __attribute__((packed)) JournalState {
+        int32_t  webId;
+        uint8_t  flags;             // BINARY_FLAG_*
+    };
+    
+    Alarm     _alarms[Capacity];   // hot: scheduling fields scanned by check()
+    AlarmInfo _info[Capacity];     // cold: names and web IDs, same index as _alarms
+    char      _strings[StringBytes]; // name/description arena, kept compact
+    size_t    _stringsUsed = 0;
+    IndexT    _num = 0;            // alarms in use
+    int       _nextWebId = 1;      // above every web ID handed out since clear()
+    
+    // Slot map: a deleted alarm leaves a free slot, linked from _freeHead and
+    // reused by the next add. The generation is odd while the slot is in use.
+    uint16_t  _generation[Capacity] = {};
+    IndexT    _nextFree[Capacity];
+    IndexT    _freeHead = INVALID_INDEX;
+    IndexT    _slotEnd = 0;        // slots handed out since clear(): bound of every scan
+    
+    // Web ID -> slot of the customizable alarms, open addressing (linear probing)
+    static constexpr size_t WEBID_SLOTS = 2 * Capacity;
+    IndexT    _webIdIndex[WEBID_SLOTS];
+    bool      _webIdIndexDirty = true; // rebuilt on the next lookup
+    
+    // Persistence of customizable alarms: journal appends, debounced snapshot
+    AlarmStorage* _storage = _defaultStorage();
+    bool      _pendingSave = false;
+    bool      _partialLoad = false; // last load shortened or dropped alarms
+    bool      _autoSave = true;
+    uint32_t  _saveDebounceMs = DEFAULT_SAVE_DEBOUNCE_MS;
+    uint32_t  _lastChangeMs = 0;
+    size_t    _journalBytes = 0;   // valid bytes in JOURNAL_FILE
+    int8_t    _snapshotSlot = -1;  // slot holding the newest valid snapshot (-1 = unknown)
+    uint32_t  _snapshotSequence = 0; // highest sequence seen in either slot
+    uint32_t  _journalBase = 0;      // sequence of the loaded snapshot (0 = none), written in BASE
+    AlarmPersistence _persistence = PERSIST_SNAPSHOT;
+    
+    // Seqlock over the table: odd while an edit is in progress. Edits run on the
+    // check() task; the JSON readers may run on another task and read again
+    // when an edit overlapped, without a lock that would stall check()
+    std::atomic<uint32_t> _sequence{0};
+    uint8_t   _writeDepth = 0;     // nested write sections (loads call the editors)
+    uint32_t  _scheduleSequence = 0; // _sequence the schedule was built from
+    
+    // Write section for the rest of the enclosing scope
+    struct WriteSection {
+        explicit WriteSection(BasicAlarmScheduler& owner) : scheduler(owner) { scheduler._beginWrite(); }
+        ~WriteSection() { scheduler._endWrite(); }
+        BasicAlarmScheduler& scheduler;
+    };
+    
+    // Mutation version of the alarm table and the cached customizable list
+    uint32_t  _version = 0;        // bumped by every change visible in the JSON
+    uint32_t  _bootId = esp_random(); // tells versions of different boots apart in the ETag
+    
+    // getCustomizablesJSON() text. Readers on several tasks share it: a rebuild
+    // publishes a new one by atomic pointer swap, and the old one is freed when
+    // its last reader lets go
+    struct JsonCache {
+        uint32_t version = 0;
+        uint32_t fires = 0;        // _firesTotal when built (ALARMSCHEDULER_STATS)
+        String   text;
+    };
+    std::shared_ptr<const JsonCache> _jsonCache;   // std::atomic_load / std::atomic_store only
+    
+    // Action table: Alarm::actionId is the entry index + 1. Registered types are
+    // also in an open-addressing hash of their names, so binding a loaded alarm
+    // to its callback does not compare strings against every entry.
+    enum ActionKind : uint8_t {
+        ACTION_METHOD,             // member method with parameter
+        ACTION_EXTERNAL,           // external function with parameter
+        ACTION_EXTERNAL0           // external function without parameter
+    };
+    struct ActionEntry {
+        union {
+            void (BasicAlarmScheduler::*method)(uint16_t);
+            void (*external)(uint16_t);
+            void (*external0)();
+        };
+        uint32_t   hash;           // FNV-1a of type (registered entries only)
+        char       type[sizeof(AlarmInfo::typeString)]; // empty = unnamed callback
+        ActionKind kind;
+        uint16_t   refs;           // alarms using it; an unnamed entry at 0 is free
+    };
+    static constexpr size_t ACTION_SLOTS = 2 * MAX_ACTIONS; // half full at most
+    ActionEntry _actions[MAX_ACTIONS];
+    uint16_t  _actionCount = 0;    // entries ever used; freed ones are reused first
+    uint16_t  _actionSlots[ACTION_SLOTS] = {}; // action IDs of registered types (0 = empty)
+    
+    // Edits posted from other tasks, applied in order at the start of check().
+    // Producers claim a cell by advancing the tail; the cell's flag hands it to
+    // the single consumer, which frees it by advancing the head.
+    enum CommandOp : uint8_t {
+        COMMAND_ADD,
+        COMMAND_MODIFY,
+        COMMAND_DELETE,
+        COMMAND_ENABLE
+    };
+    struct Command {
+        void     (*callback)(uint16_t);
+        int32_t  webId;
+        uint16_t parameter;
+        CommandOp op;
+        uint8_t  dayMask;
+        uint8_t  hour;
+        uint8_t  minute;
+        bool     enabled;
+        char     type[sizeof(AlarmInfo::typeString)];
+        char     name[MAX_NAME_LENGTH + 1];
+        char     description[MAX_DESCRIPTION_LENGTH + 1];
+    };
+    struct CommandCell {
+        Command           command;
+        std::atomic<bool> ready{false};   // written by a producer, not yet applied
+    };
+    CommandCell _commands[ALARMSCHEDULER_COMMAND_QUEUE];
+    std::atomic<uint32_t> _commandTail{0};     // next cell a producer claims
+    std::atomic<uint32_t> _commandHead{0};     // next cell check() applies
+    std::atomic<uint32_t> _commandsDropped{0};
+    std::atomic<void (*)()> _commandNotify{nullptr};   // called on the posting task
+    
+    // Ring of the last changes (web ID and the version it produced), oldest first
+    struct ChangeEntry {
+        uint32_t version;
+        int32_t  webId;
+    };
+    ChangeEntry _changes[ALARMSCHEDULER_CHANGE_LOG];
+    size_t    _changeHead = 0;     // next slot to write
+    size_t    _changeCount = 0;
+    uint32_t  _changeFloor = 0;    // oldest version a delta can start from
+    
+    // Next-fire min-heap (indices into _alarms)
+    IndexT  _heap[Capacity];
+    IndexT  _heapSize = 0;
+    IndexT  _due[Capacity];
+    bool    _scheduleDirty = true;
+    time_t  _lastCheckTime = 0;
+    time_t  _tMinuteStart = 0;      // epoch at second 0 of the minute held in t (0 = invalid)
+    
+    // Today's fixed-time alarms, sorted by minute of day, consumed by a cursor
+    struct PlanEntry {
+        uint16_t minuteOfDay;
+        IndexT   index;
+    };
+    PlanEntry _plan[Capacity];
+    IndexT    _planSize = 0;
+    IndexT    _planCursor = 0;
+    int       _planDay = -1;        // tm_year * 366 + tm_yday the plan was built for
+    time_t    _planNextFire = 0;    // epoch of _plan[_planCursor], or first fixed alarm of a later day
+
+#ifdef ALARMSCHEDULER_STATS
+    AlarmStats _stats[Capacity];            // parallel to _alarms
+    std::atomic<uint32_t> _firesTotal{0};   // in the ETag and the cache key: the list JSON carries the stats
+    
+    // Loop health: histograms of check() time and of alarms evaluated per
+    // call (last bucket = above the last bound), and gaps between calls
+    static constexpr size_t CHECK_TIME_BUCKETS = 8;
+    static constexpr size_t EVALUATED_BUCKETS  = 6;
+    static constexpr uint32_t CHECK_TIME_BOUNDS[CHECK_TIME_BUCKETS - 1] = {10, 50, 100, 500, 1000, 5000, 10000};
+    static constexpr uint32_t EVALUATED_BOUNDS[EVALUATED_BUCKETS - 1]   = {0, 1, 3, 7, 15};
+    uint32_t  _checkTimeCounts[CHECK_TIME_BUCKETS] = {};
+    uint32_t  _evaluatedCounts[EVALUATED_BUCKETS] = {};
+    uint32_t  _checkCalls = 0;
+    uint32_t  _maxCheckUs = 0;
+    uint32_t  _lastCheckMs = 0;             // millis() at the start of the previous check()
+    uint32_t  _maxCheckGapMs = 0;
+    uint32_t  _checkGapsOverMinute = 0;     // gaps long enough to skip a whole minute
+    IndexT    _checkEvaluated = 0;          // due candidates of the running check()
+    
+    // Times check() on every return path
+    struct CheckTimer {
+        explicit CheckTimer(BasicAlarmScheduler& owner) : scheduler(owner), startUs(micros()) {
+            scheduler._checkStarted();
+        }
+        ~CheckTimer() { scheduler._checkFinished(micros() - startUs); }
+        BasicAlarmScheduler& scheduler;
+        uint32_t startUs;
+    };
+#endif
+
+#ifdef ALARMSCHEDULER_BITSLICED
+    // Wildcard alarms as bit-planes: bit (i % 32) of word (i / 32) is alarm i
+    static constexpr size_t SLICE_WORDS = (Capacity + 31) / 32;
+    uint32_t  _sliceEnabled[SLICE_WORDS];       // enabled wildcard alarm without interval
+    uint32_t  _sliceDay[7][SLICE_WORDS];        // dayMask, one plane per weekday
+    uint32_t  _sliceHourAny[SLICE_WORDS];       // hour == ALARM_WILDCARD
+    uint32_t  _sliceHour[5][SLICE_WORDS];       // hour, one plane per bit
+    uint32_t  _sliceMinuteAny[SLICE_WORDS];     // minute == ALARM_WILDCARD
+    uint32_t  _sliceMinute[6][SLICE_WORDS];     // minute, one plane per bit
+    bool      _sliceUsed = false;
+    time_t    _sliceNextMinute = 0;             // start of the next minute to match
+#endif
 
     // Helper methods
     static uint8_t _dayMaskFromWeekday(int weekday);
-    uint8_t _findIndexByWebId(int webId);
+    bool    _isDue(const Alarm& alarm) const;
+    void    _dispatch(IndexT idx);
+    static uint32_t _hashType(const char* type);
+    uint16_t _findAction(const char* type) const;
+    uint16_t _newAction();
+    uint16_t _internAction(const ActionEntry& action);
+    uint16_t _bindAction(const char* type, void (*callback)(uint16_t));
+    void     _setAction(Alarm& alarm, uint16_t actionId);
+    void    _rebuildSchedule(time_t now);
+    static bool _isFixedTime(const Alarm& alarm);
+    static bool _isSliced(const Alarm& alarm);
+#ifdef ALARMSCHEDULER_BITSLICED
+    void    _buildSlices();
+    IndexT  _matchSlices(IndexT dueCount);
+#endif
+    void    _compilePlan(time_t now);
+    void    _updatePlanNextFire(time_t now);
+    time_t  _computeNextFire(const Alarm& alarm, time_t from) const;
+    static time_t _findNextMatch(uint8_t dayMask, uint8_t hour, uint8_t minute, time_t from);
+    static time_t _findNextInterval(const Alarm& alarm, time_t from);
+    static long   _intervalAnchor(const Alarm& alarm);
+    static long   _nextGridMinute(long minute, long anchor, long interval);
+    static long   _localMinuteIndex(const struct tm& local);
+    static time_t _localToEpoch(const struct tm& day, uint8_t hour, uint8_t minute);
+    bool    _heapLess(IndexT a, IndexT b) const;
+    void    _heapPush(IndexT idx);
+    void    _heapSiftDown(IndexT pos);
+    const char* _string(uint16_t offset) const;
+    static size_t _stringCost(const char* text, size_t maxLength);
+    bool    _stringsFit(const AlarmInfo& info, const char* name, const char* description) const;
+    bool    _setStrings(AlarmInfo& info, const char* name, const char* description);
+    bool    _fitStrings(AlarmInfo& info, const char* name, const char* description);
+    uint16_t _storeString(const char* text);
+    void    _releaseString(uint16_t& offset);
+    bool    _isLive(IndexT idx) const;
+    IndexT  _nextSlot() const;
+    void    _claimSlot(IndexT idx);
+    void    _rebuildFreeList();
+    static size_t _webIdHome(int webId);
+    void    _indexWebId(IndexT idx);
+    void    _unindexWebId(IndexT idx);
+    void    _rebuildWebIdIndex();
+    void    _removeAlarm(IndexT idx);
+    void    _removeCustomizables();
+    bool    _readAlarmsJSON(bool apply, int& loaded);
+    bool    _restoreCustomizable(int webId, const char* name, const char* description,
+                                 uint8_t dayMask, uint8_t hour, uint8_t minute, uint16_t intervalMin,
+                                 const char* typeString, bool enabled, uint16_t parameter);
+    void    _packRecord(IndexT idx, BinaryRecord& record) const;
+    static AlarmStorage* _defaultStorage();
+    static const char* _snapshotFile(int slot);
+    bool    _readSnapshotHeader(BinaryHeader& header);
+    int     _scanSnapshots();
+    bool    _loadSnapshot();
+    bool    _loadSnapshotSlot(int slot);
+    void    _replayJournal();
+    void    _applyJournalEntry(uint8_t op, const uint8_t* payload, size_t length);
+    bool    _loadSnapshotAndJournal();
+    void    _persistPut(IndexT idx, bool added);
+    void    _persistState(uint8_t op, int webId, bool enabled);
+    size_t  _packPut(IndexT idx, uint8_t* payload);
+    void    _appendJournal(uint8_t op, const uint8_t* payload, size_t length);
+    bool    _writeEntry(const char* path, bool append, uint8_t op, const uint8_t* payload, size_t length);
+    bool    _readEntry(JournalEntry& entry, uint8_t* payload);
+    static const char* _recordFile(int webId, char* path);
+    bool    _saveRecords();
+    bool    _storeIndex();
+    size_t  _readIndexChunk(size_t position, int32_t* webIds, size_t maxCount);
+    size_t  _printCustomizablesJSON(Print& out, bool webFields);
+    bool    _fillAlarmJSON(JsonDocument& element, IndexT idx, bool webFields);
+    std::shared_ptr<const JsonCache> _currentJsonCache() const;   // null when stale
+    uint32_t _readVersion() const;
+#ifdef ALARMSCHEDULER_STATS
+    void    _checkStarted();
+    void    _checkFinished(uint32_t elapsedUs);
+    static size_t _bucket(uint32_t value, const uint32_t* bounds, size_t boundCount);
+    static void _histogramJSON(JsonObject out, const uint32_t* bounds, const uint32_t* counts, size_t buckets);
+#endif
+    bool    _postCommand(CommandOp op, int webId, const char* name, const char* description,
+                         uint8_t dayMask, uint8_t hour, uint8_t minute, const char* typeString,
+                         uint16_t parameter, void (*callback)(uint16_t), bool enabled);
+    void    _drainCommands();
+    void    _beginWrite();
+    void    _endWrite();
+    uint32_t _readBegin() const;
+    bool    _readRetry(uint32_t sequence) const;
+    void    _copyString(uint16_t offset, char* buffer, size_t size) const;
+    bool    _webIdLive(int webId) const;
+    void    _noteChange(int webId);
+    void    _noteReset();
+    const ChangeEntry& _changeAt(size_t position) const;
+    static bool _changedSince(const ChangeEntry* changes, size_t count, int webId, uint32_t version);
+    bool    _loadRecords();
+    static uint32_t _crc32(uint32_t crc, const uint8_t* data, size_t length);
+    void    _markPendingSave();
+    IndexT  _findIndexByWebId(int webId);
     int     _generateNewWebId();
     String  _dayToString(int day);
     void    _createDefaultCustomizableAlarms();
 };
 
+/**
+ * @brief Default scheduler: 16 alarms with uint8_t indices (INVALID_INDEX = 255)
+ */
+typedef BasicAlarmScheduler<16, uint8_t> AlarmScheduler;
+
+#include "AlarmSchedulerImpl.h"
+
+// The default configuration is compiled once in AlarmScheduler.cpp
+extern template class BasicAlarmScheduler<16, uint8_t>;
+
 #endif // ALARMSCHEDULER_H
@@ -0,0 +1,3325 @@
+/**
+ * @file AlarmSchedulerImpl.h
+ * @brief Template implementation of BasicAlarmScheduler
+ * 
+ * @details Included at the end of AlarmScheduler.h, do not include directly.
+ *          The default AlarmScheduler (16 alarms) is instantiated once in
+ *          AlarmScheduler.cpp; other capacities are instantiated on use.
+ * 
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ * @version 1.0.0
+ */
+
+#ifndef ALARMSCHEDULER_IMPL_H
+#define ALARMSCHEDULER_IMPL_H
+
+// ============================================================================
+// STATIC MEMBERS
+// ============================================================================
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::MAX_ALARMS;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::INVALID_INDEX;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::NO_ALARM_DUE;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::DEFAULT_SAVE_DEBOUNCE_MS;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::BINARY_FILE;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::BINARY_FILE_B;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::JOURNAL_FILE;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::JOURNAL_COMPACT_BYTES;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::JSON_FILE;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::RECORD_FILE_PREFIX;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::RECORD_INDEX_FILE;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::MAX_NAME_LENGTH;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::MAX_DESCRIPTION_LENGTH;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::MAX_ACTIONS;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr uint16_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::NO_ACTION;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::ETAG_SIZE;
+
+#ifdef ALARMSCHEDULER_STATS
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::CHECK_TIME_BUCKETS;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::EVALUATED_BUCKETS;
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::CHECK_TIME_BOUNDS[];
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+constexpr uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::EVALUATED_BOUNDS[];
+#endif
+
+// ============================================================================
+// PUBLIC METHOD IMPLEMENTATIONS
+// ============================================================================
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::begin(bool loadDefaults) {
+    clear();
+    
+    DBG_ALM("[ALARM] Loading customizable alarms from storage...");
+    if (!loadCustomizables()) {
+        // JSON file from an older version: imported, then saved as a snapshot
+        loadCustomizablesFromJSON();
+    }
+    
+    if (loadDefaults && _num == 0) {
+        DBG_ALM("[ALARM] No alarms found, creating defaults...");
+        _createDefaultCustomizableAlarms();
+    }
+    
+    DBG_ALM_PRINTF("[ALARM] System initialized with %u alarms\n", _num);
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::add(uint8_t dayMask,
+                                                               uint8_t hour,
+                                                               uint8_t minute,
+                                                               uint16_t intervalMin,
+                                                               void (BasicAlarmScheduler::*action)(uint16_t),
+                                                               uint16_t parameter,
+                                                               bool enabled)
+{
+    IndexT idx = _nextSlot();
+    if (idx == INVALID_INDEX) {
+        DBG_ALM_PRINTF("[ALARM] Error: Maximum alarms reached (%u)\n", (unsigned)MAX_ALARMS);
+        return INVALID_INDEX;
+    }
+    
+    ActionEntry entry = {};
+    entry.kind = ACTION_METHOD;
+    entry.method = action;
+    uint16_t actionId = action ? _internAction(entry) : NO_ACTION;
+    if (action && actionId == NO_ACTION) {
+        DBG_ALM_PRINTF("[ALARM] Error: Action table full (%u)\n", (unsigned)MAX_ACTIONS);
+        return INVALID_INDEX;
+    }
+    
+    WriteSection section(*this);
+    Alarm &alarm = _alarms[idx];
+    alarm.enabled        = enabled;
+    alarm.dayMask        = (dayMask ? dayMask : (uint8_t)DOW_ALL);
+    alarm.hour           = hour;
+    alarm.minute         = minute;
+    alarm.intervalMin    = intervalMin;
+    alarm.lastYearDay    = -1;
+    alarm.lastMinute     = 255;
+    alarm.lastHour       = 255;
+    alarm.lastExecution  = 0;
+    _setAction(alarm, actionId);
+    alarm.parameter      = parameter;
+    _info[idx]           = AlarmInfo();  // SYSTEM, not customizable, no web ID
+    _claimSlot(idx);
+    _scheduleDirty       = true;
+    
+    DBG_ALM_PRINTF("[ALARM] Added method alarm idx=%u, days=0x%02X, %02u:%02u, interval=%u min, param=%u\n",
+                   idx, dayMask, hour, minute, intervalMin, parameter);
+    
+    return idx;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::addExternal(uint8_t dayMask,
+                                                                       uint8_t hour,
+                                                                       uint8_t minute,
+                                                                       uint16_t intervalMin,
+                                                                       void (*ext)(uint16_t),
+                                                                       uint16_t parameter,
+                                                                       bool enabled)
+{
+    IndexT idx = _nextSlot();
+    if (idx == INVALID_INDEX) {
+        DBG_ALM_PRINTF("[ALARM] Error: Maximum alarms reached (%u)\n", (unsigned)MAX_ALARMS);
+        return INVALID_INDEX;
+    }
+    
+    ActionEntry entry = {};
+    entry.kind = ACTION_EXTERNAL;
+    entry.external = ext;
+    uint16_t actionId = ext ? _internAction(entry) : NO_ACTION;
+    if (ext && actionId == NO_ACTION) {
+        DBG_ALM_PRINTF("[ALARM] Error: Action table full (%u)\n", (unsigned)MAX_ACTIONS);
+        return INVALID_INDEX;
+    }
+    
+    WriteSection section(*this);
+    Alarm &alarm = _alarms[idx];
+    alarm.enabled        = enabled;
+    alarm.dayMask        = (dayMask ? dayMask : (uint8_t)DOW_ALL);
+    alarm.hour           = hour;
+    alarm.minute         = minute;
+    alarm.intervalMin    = intervalMin;
+    alarm.lastYearDay    = -1;
+    alarm.lastMinute     = 255;
+    alarm.lastHour       = 255;
+    alarm.lastExecution  = 0;
+    _setAction(alarm, actionId);
+    alarm.parameter      = parameter;
+    _info[idx]           = AlarmInfo();  // SYSTEM, not customizable, no web ID
+    _claimSlot(idx);
+    _scheduleDirty       = true;
+    
+    DBG_ALM_PRINTF("[ALARM] Added external alarm idx=%u, days=0x%02X, %02u:%02u, interval=%u min, param=%u\n",
+                   idx, dayMask, hour, minute, intervalMin, parameter);
+    
+    return idx;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::addExternal0(uint8_t dayMask,
+                                                                        uint8_t hour,
+                                                                        uint8_t minute,
+                                                                        uint16_t intervalMin,
+                                                                        void (*ext0)(),
+                                                                        bool enabled)
+{
+    IndexT idx = _nextSlot();
+    if (idx == INVALID_INDEX) {
+        DBG_ALM_PRINTF("[ALARM] Error: Maximum alarms reached (%u)\n", (unsigned)MAX_ALARMS);
+        return INVALID_INDEX;
+    }
+    
+    ActionEntry entry = {};
+    entry.kind = ACTION_EXTERNAL0;
+    entry.external0 = ext0;
+    uint16_t actionId = ext0 ? _internAction(entry) : NO_ACTION;
+    if (ext0 && actionId == NO_ACTION) {
+        DBG_ALM_PRINTF("[ALARM] Error: Action table full (%u)\n", (unsigned)MAX_ACTIONS);
+        return INVALID_INDEX;
+    }
+    
+    WriteSection section(*this);
+    Alarm &alarm = _alarms[idx];
+    alarm.enabled        = enabled;
+    alarm.dayMask        = (dayMask ? dayMask : (uint8_t)DOW_ALL);
+    alarm.hour           = hour;
+    alarm.minute         = minute;
+    alarm.intervalMin    = intervalMin;
+    alarm.lastYearDay    = -1;
+    alarm.lastMinute     = 255;
+    alarm.lastHour       = 255;
+    alarm.lastExecution  = 0;
+    _setAction(alarm, actionId);
+    alarm.parameter      = 0;
+    _info[idx]           = AlarmInfo();  // SYSTEM, not customizable, no web ID
+    _claimSlot(idx);
+    _scheduleDirty       = true;
+    
+    DBG_ALM_PRINTF("[ALARM] Added external0 alarm idx=%u, days=0x%02X, %02u:%02u, interval=%u min\n",
+                   idx, dayMask, hour, minute, intervalMin);
+    
+    return idx;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::check() {
+#ifdef ALARMSCHEDULER_STATS
+    CheckTimer timer(*this);
+#endif
+    
+    // Edits posted from other tasks are applied here, on the scheduler task
+    _drainCommands();
+    
+    // An edit open on another task leaves the table half written: next tick.
+    // Any edit since the last build rebuilds the queue, even if the dirty
+    // flag it set has not reached this task yet
+    uint32_t sequence = _sequence.load(std::memory_order_acquire);
+    if (sequence & 1) return;
+    if (sequence != _scheduleSequence) _scheduleDirty = true;
+    
+    // Write-behind: snapshot once the last change has been quiet for the debounce window
+    if (_pendingSave && _autoSave && (millis() - _lastChangeMs) >= _saveDebounceMs) {
+        guardarPendientes();
+    }
+    
+    time_t now = time(nullptr);
+    
+    // Clock stepped backwards (NTP correction, manual set): queued times are stale
+    bool stepped = (now < _lastCheckTime);
+    if (stepped) {
+        DBG_ALM_PRINTF("[ALARM] Clock step detected (%ld -> %ld), rebuilding queue",
+                       (long)_lastCheckTime, (long)now);
+        _scheduleDirty = true;
+    }
+    
+    if (!stepped && _tMinuteStart != 0 && now >= _tMinuteStart && now < _tMinuteStart + 60) {
+        // Same minute as the cached broken-down time: only the seconds move
+        t.tm_sec = (int)(now - _tMinuteStart);
+    } else {
+        // New minute or clock step: full local time conversion (timezone, DST)
+        localtime_r(&now, &t);
+        if (t.tm_year <= (2016 - 1900)) {  // clock not set yet, same test as getLocalTime()
+            _tMinuteStart = 0;
+            return;
+        }
+        _tMinuteStart = now - t.tm_sec;
+    }
+    _lastCheckTime = now;
+    
+    if (_scheduleDirty) {
+        _rebuildSchedule(now);
+        _scheduleSequence = sequence;
+    }
+    
+    // Common case: nothing due, one comparison against the plan and the heap top
+    bool planDue = (_planNextFire != 0 && _planNextFire <= now);
+    bool heapDue = (_heapSize > 0 && _alarms[_heap[0]].nextFire <= now);
+#ifdef ALARMSCHEDULER_BITSLICED
+    bool sliceDue = (_sliceUsed && _sliceNextMinute <= now);
+    if (!planDue && !heapDue && !sliceDue) return;
+#else
+    if (!planDue && !heapDue) return;
+#endif
+    
+    IndexT dueCount = 0;
+    
+    if (planDue) {
+        // New day: today's plan replaces the one just finished
+        if (t.tm_year * 366 + t.tm_yday != _planDay) {
+            _compilePlan(now);
+        }
+        
+        // Entries of minutes that were missed are skipped, as a full scan would
+        uint16_t nowMinute = t.tm_hour * 60 + t.tm_min;
+        while (_planCursor < _planSize && _plan[_planCursor].minuteOfDay <= nowMinute) {
+            if (_plan[_planCursor].minuteOfDay == nowMinute) {
+                _due[dueCount++] = _plan[_planCursor].index;
+            }
+            ++_planCursor;
+        }
+        _updatePlanNextFire(now);
+    }
+    
+#ifdef ALARMSCHEDULER_BITSLICED
+    if (sliceDue) {
+        dueCount = _matchSlices(dueCount);
+        _sliceNextMinute = now - t.tm_sec + 60;
+    }
+#endif
+    
+    // Pop every due candidate, then run them in array order like a full scan would
+    while (_heapSize > 0 && _alarms[_heap[0]].nextFire <= now) {
+        _due[dueCount++] = _heap[0];
+        _heap[0] = _heap[--_heapSize];
+        _heapSiftDown(0);
+    }
+    
+    for (IndexT k = 1; k < dueCount; ++k) {
+        IndexT idx = _due[k];
+        IndexT j = k;
+        for (; j > 0 && _due[j - 1] > idx; --j) {
+            _due[j] = _due[j - 1];
+        }
+        _due[j] = idx;
+    }
+#ifdef ALARMSCHEDULER_STATS
+    _checkEvaluated = dueCount;
+#endif
+    
+    // Edits belong on this task (or in the command queue). One that started on
+    // another task after the test above makes what was read stale: drop it and
+    // run this tick again on the next call, from a rebuilt queue
+    if (_sequence.load(std::memory_order_acquire) != sequence) {
+        DBG_ALM("[ALARM] Table edited during check() from another task, tick repeated");
+        _scheduleDirty = true;
+        return;
+    }
+    
+    time_t nextMinute = now - t.tm_sec + 60;
+    
+    for (IndexT k = 0; k < dueCount; ++k) {
+        IndexT i = _due[k];
+        if (!_isLive(i)) continue;  // deleted from inside a callback
+        
+        Alarm &alarm = _alarms[i];
+        bool fixedTime = _isFixedTime(alarm);
+        
+        // A plan entry is due by construction (unless a callback just changed
+        // the table); the queue only narrows the candidates, the full rule decides
+        if ((fixedTime && !_scheduleDirty) ? alarm.enabled : _isDue(alarm)) {
+#ifdef ALARMSCHEDULER_STATS
+            // Late by the seconds into the minute plus the callbacks run before it
+            uint32_t startUs = micros();
+            uint32_t lateMs = (uint32_t)t.tm_sec * 1000 + (startUs - timer.startUs) / 1000;
+            uint16_t generation = _generation[i];
+            _dispatch(i);
+            if (_generation[i] == generation) {     // not deleted by its own callback
+                AlarmStats& stats = _stats[i];
+                stats.fires++;
+                stats.lastMicros = micros() - startUs;
+                if (stats.lastMicros > stats.maxMicros) stats.maxMicros = stats.lastMicros;
+                stats.lastLateMs = (lateMs > 0xFFFF) ? 0xFFFF : (uint16_t)lateMs;
+                if (stats.lastLateMs > stats.maxLateMs) stats.maxLateMs = stats.lastLateMs;
+                _firesTotal.fetch_add(1, std::memory_order_relaxed);
+            }
+#else
+            _dispatch(i);
+#endif
+            
+            // Update cache
+            alarm.lastYearDay    = t.tm_yday;
+            alarm.lastMinute     = t.tm_min;
+            alarm.lastHour       = t.tm_hour;
+            alarm.lastExecution  = now;
+        }
+        
+        // A callback that modified the table already forced a full rebuild
+        if (_scheduleDirty || fixedTime || _isSliced(alarm)) continue;
+        
+        alarm.nextFire = _computeNextFire(alarm, nextMinute);
+        if (alarm.nextFire != 0) {
+            _heapPush(i);
+        }
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::msHastaProximaAlarma() const {
+    // Pending rebuild: check() must run first to know the real next time
+    if (_scheduleDirty) return 0;
+    
+    // Edits posted from another task are applied by the next check()
+    uint32_t head = _commandHead.load(std::memory_order_relaxed);
+    if (_commands[head % ALARMSCHEDULER_COMMAND_QUEUE].ready.load(std::memory_order_acquire)) return 0;
+    
+    // Pending auto-save: wake up when its debounce window ends
+    uint32_t saveMs = NO_ALARM_DUE;
+    if (_pendingSave && _autoSave) {
+        uint32_t quiet = millis() - _lastChangeMs;
+        if (quiet >= _saveDebounceMs) return 0;
+        saveMs = _saveDebounceMs - quiet;
+    }
+    
+    time_t next = _planNextFire;
+    if (_heapSize > 0 && (next == 0 || _alarms[_heap[0]].nextFire < next)) {
+        next = _alarms[_heap[0]].nextFire;
+    }
+#ifdef ALARMSCHEDULER_BITSLICED
+    if (_sliceUsed && (next == 0 || _sliceNextMinute < next)) {
+        next = _sliceNextMinute;
+    }
+#endif
+    if (next == 0) return saveMs;
+    
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    
+    if (next <= tv.tv_sec) return 0;
+    
+    uint64_t ms = (uint64_t)(next - tv.tv_sec) * 1000 - tv.tv_usec / 1000;
+    if (ms > saveMs) return saveMs;
+    return (ms >= NO_ALARM_DUE) ? NO_ALARM_DUE - 1 : (uint32_t)ms;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::msUntilNextDue() const {
+    return msHastaProximaAlarma();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::disable(IndexT idx) { 
+    if (_isLive(idx)) {
+        WriteSection section(*this);
+        _alarms[idx].enabled = false;
+        _scheduleDirty = true;
+        if (_info[idx].isCustomizable) _noteChange(_info[idx].webId);
+        DBG_ALM_PRINTF("[ALARM] Alarm idx=%u disabled\n", idx);
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::enable(IndexT idx) { 
+    if (_isLive(idx)) {
+        WriteSection section(*this);
+        _alarms[idx].enabled = true;
+        _scheduleDirty = true;
+        if (_info[idx].isCustomizable) _noteChange(_info[idx].webId);
+        DBG_ALM_PRINTF("[ALARM] Alarm idx=%u enabled\n", idx);
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::clear() { 
+    WriteSection section(*this);
+    
+    // Free slots hold default records; a new generation invalidates old handles
+    for (IndexT i = 0; i < _slotEnd; ++i) {
+        if (_generation[i] & 1) _generation[i]++;
+        _setAction(_alarms[i], NO_ACTION);
+        _alarms[i] = Alarm();
+        _info[i]   = AlarmInfo();
+    }
+    _num = 0; 
+    _slotEnd = 0;
+    _freeHead = INVALID_INDEX;
+    _webIdIndexDirty = true;
+    _nextWebId = 1;
+    _heapSize = 0;
+    _stringsUsed = 0;
+    _partialLoad = false;
+    _scheduleDirty = true;
+    _noteReset();
+    DBG_ALM("[ALARM] All alarms cleared\n");
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::count() const { 
+    return _num; 
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::slotEnd() const { 
+    return _slotEnd; 
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+typename BasicAlarmScheduler<Capacity, IndexT, StringBytes>::Handle BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getHandle(IndexT idx) const { 
+    Handle handle;
+    handle.index      = _isLive(idx) ? idx : INVALID_INDEX;
+    handle.generation = _isLive(idx) ? _generation[idx] : 0;
+    return handle;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::resolve(Handle handle) const { 
+    return (_isLive(handle.index) && _generation[handle.index] == handle.generation) ? handle.index : INVALID_INDEX;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const typename BasicAlarmScheduler<Capacity, IndexT, StringBytes>::Alarm* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::get(IndexT idx) const { 
+    return _isLive(idx) ? &_alarms[idx] : nullptr; 
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+typename BasicAlarmScheduler<Capacity, IndexT, StringBytes>::Alarm* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getMutable(IndexT idx) { 
+    if (!_isLive(idx)) return nullptr;
+    _scheduleDirty = true;  // caller may change timing fields
+    return &_alarms[idx];
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const AlarmInfo* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getInfo(IndexT idx) const { 
+    return _isLive(idx) ? &_info[idx] : nullptr; 
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+AlarmInfo* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getInfoMutable(IndexT idx) { 
+    if (!_isLive(idx)) return nullptr;
+    _webIdIndexDirty = true;  // caller may change the web ID
+    return &_info[idx];
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::notifyChanged(IndexT idx) { 
+    WriteSection section(*this);
+    _scheduleDirty = true;
+    _webIdIndexDirty = true;
+    
+    if (idx == INVALID_INDEX) {
+        _noteReset();       // several alarms or web IDs changed: clients reload the list
+    } else if (_isLive(idx) && _info[idx].isCustomizable) {
+        _noteChange(_info[idx].webId);
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getName(IndexT idx) const { 
+    return _isLive(idx) ? _string(_info[idx].nameOffset) : ""; 
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getDescription(IndexT idx) const { 
+    return _isLive(idx) ? _string(_info[idx].descriptionOffset) : ""; 
+}
+
+#ifdef ALARMSCHEDULER_STATS
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const AlarmStats* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getStats(IndexT idx) const { 
+    return _isLive(idx) ? &_stats[idx] : nullptr; 
+}
+#endif
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::resetCache() {
+    for (IndexT i = 0; i < _slotEnd; ++i) {
+        _alarms[i].lastYearDay = -1;
+        _alarms[i].lastMinute = 255;
+        _alarms[i].lastHour = 255;
+        _alarms[i].lastExecution = 0;
+    }
+    _tMinuteStart = 0;
+    _scheduleDirty = true;
+    DBG_ALM_PRINTF("[ALARM] Cache of %u alarms reset\n", _num);
+}
+
+// ============================================================================
+// CUSTOMIZABLE ALARM MANAGEMENT - SPANISH NAMES
+// ============================================================================
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::addPersonalizable(const char* nombre, const char* descripcion,
+                                                                             uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
+                                                                             const char* tipoString, uint16_t parametro,
+                                                                             void (*callback)(uint16_t), bool habilitada) {
+    IndexT idx = _nextSlot();
+    if (idx == INVALID_INDEX) {
+        DBG_ALM("Error: Maximum alarms reached");
+        return INVALID_INDEX;
+    }
+    
+    Alarm& alarma = _alarms[idx];
+    AlarmInfo& info = _info[idx];
+    
+    // Checked before binding, so a full arena does not leave an action entry behind
+    if (!_stringsFit(info, nombre, descripcion)) {
+        DBG_ALM("Error: String arena full");
+        return INVALID_INDEX;
+    }
+    
+    // Without a callback the alarm runs the action registered for its type
+    uint16_t idAccion = _bindAction(tipoString, callback);
+    if (callback != nullptr && idAccion == NO_ACTION) {
+        DBG_ALM("Error: Action table full");
+        return INVALID_INDEX;
+    }
+    
+    {
+        // Storing the strings may move the arena under a reader on another task
+        WriteSection section(*this);
+        
+        _setStrings(info, nombre, descripcion);
+        
+        alarma.enabled = habilitada;
+        alarma.dayMask = mascaraDias;
+        alarma.hour = hora;
+        alarma.minute = minuto;
+        alarma.intervalMin = 0;
+        alarma.parameter = parametro;
+        _setAction(alarma, idAccion);
+        
+        strncpy(info.typeString, tipoString, sizeof(info.typeString) - 1);
+        info.typeString[sizeof(info.typeString) - 1] = '\0';
+        
+        info.isCustomizable = true;
+        info.webId = _generateNewWebId();
+        _claimSlot(idx);
+        _indexWebId(idx);
+        _scheduleDirty = true;
+        _noteChange(info.webId);
+    }
+    
+    DBG_ALM_PRINTF("Customizable alarm created - Index: %d, Web ID: %d", idx, info.webId);
+    
+    _persistPut(idx, true);
+    
+    return idx;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::modificarPersonalizable(int idWeb, const char* nombre, const char* descripcion,
+                                                                                 uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
+                                                                                 const char* tipoString, bool habilitada,
+                                                                                 void (*callback)(uint16_t), uint16_t parametro) {
+    IndexT idx = _findIndexByWebId(idWeb);
+    if (idx == INVALID_INDEX) {
+        DBG_ALM("Error: Alarm not found");
+        return false;
+    }
+    
+    Alarm& alarma = _alarms[idx];
+    AlarmInfo& info = _info[idx];
+    
+    if (!info.isCustomizable) {
+        DBG_ALM("Error: Alarm is not customizable");
+        return false;
+    }
+    
+    if (!_stringsFit(info, nombre, descripcion)) {
+        DBG_ALM("Error: String arena full");
+        return false;
+    }
+    
+    // Without a callback the alarm runs the action registered for its type
+    uint16_t idAccion = _bindAction(tipoString, callback);
+    if (idAccion == NO_ACTION) {
+        DBG_ALM(callback ? "Error: Action table full" : "Error: Callback is NULL and type not registered");
+        return false;
+    }
+    
+    {
+        WriteSection section(*this);
+        
+        _setStrings(info, nombre, descripcion);
+        
+        alarma.enabled = habilitada;
+        alarma.dayMask = mascaraDias;
+        alarma.hour = hora;
+        alarma.minute = minuto;
+        _setAction(alarma, idAccion);
+        alarma.parameter = parametro;
+        
+        strncpy(info.typeString, tipoString, sizeof(info.typeString) - 1);
+        info.typeString[sizeof(info.typeString) - 1] = '\0';
+        
+        alarma.lastYearDay = -1;
+        alarma.lastMinute = 255;
+        alarma.lastHour = 255;
+        alarma.lastExecution = 0;
+        _scheduleDirty = true;
+        _noteChange(idWeb);
+    }
+    
+    _persistPut(idx, false);
+    
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::eliminarPersonalizable(int idWeb) {
+    IndexT idx = _findIndexByWebId(idWeb);
+    if (idx == INVALID_INDEX) {
+        DBG_ALM("Error: Alarm not found");
+        return false;
+    }
+    
+    if (!_info[idx].isCustomizable) {
+        DBG_ALM("Error: Alarm is not customizable");
+        return false;
+    }
+    
+    {
+        WriteSection section(*this);
+        _removeAlarm(idx);
+        _noteChange(idWeb);
+    }
+    
+    DBG_ALM("Customizable alarm deleted");
+    
+    _persistState(JOURNAL_DELETE, idWeb, false);
+    
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::habilitarPersonalizable(int idWeb, bool estado) {
+    IndexT idx = _findIndexByWebId(idWeb);
+    if (idx == INVALID_INDEX) {
+        DBG_ALM("Error: Alarm not found");
+        return false;
+    }
+    
+    if (!_info[idx].isCustomizable) {
+        DBG_ALM("Error: Alarm is not customizable");
+        return false;
+    }
+    
+    {
+        WriteSection section(*this);
+        _alarms[idx].enabled = estado;
+        
+        if (estado) {
+            _alarms[idx].lastYearDay = -1;
+            _alarms[idx].lastMinute = 255;
+            _alarms[idx].lastHour = 255;
+            _alarms[idx].lastExecution = 0;
+        }
+        _scheduleDirty = true;
+        _noteChange(idWeb);
+    }
+    
+    DBG_ALM_PRINTF("Customizable alarm %s", estado ? "enabled" : "disabled");
+    
+    _persistState(JOURNAL_ENABLE, idWeb, estado);
+    
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::encolarAltaPersonalizable(const char* nombre, const char* descripcion,
+                                                                                   uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
+                                                                                   const char* tipoString, uint16_t parametro,
+                                                                                   void (*callback)(uint16_t), bool habilitada) {
+    return _postCommand(COMMAND_ADD, 0, nombre, descripcion, mascaraDias, hora, minuto,
+                        tipoString, parametro, callback, habilitada);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::encolarModificacionPersonalizable(int idWeb, const char* nombre, const char* descripcion,
+                                                                                           uint8_t mascaraDias, uint8_t hora, uint8_t minuto,
+                                                                                           const char* tipoString, bool habilitada,
+                                                                                           void (*callback)(uint16_t), uint16_t parametro) {
+    return _postCommand(COMMAND_MODIFY, idWeb, nombre, descripcion, mascaraDias, hora, minuto,
+                        tipoString, parametro, callback, habilitada);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::encolarEliminacionPersonalizable(int idWeb) {
+    return _postCommand(COMMAND_DELETE, idWeb, nullptr, nullptr, 0, 0, 0, nullptr, 0, nullptr, false);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::encolarHabilitacionPersonalizable(int idWeb, bool estado) {
+    return _postCommand(COMMAND_ENABLE, idWeb, nullptr, nullptr, 0, 0, 0, nullptr, 0, nullptr, estado);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::comandosDescartados() const {
+    return _commandsDropped.load(std::memory_order_relaxed);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::configurarAvisoComando(void (*aviso)()) {
+    _commandNotify.store(aviso, std::memory_order_release);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::registrarAccion(const char* tipo, void (*accion)(uint16_t)) {
+    if (tipo == nullptr || *tipo == '\0' || accion == nullptr) {
+        DBG_ALM("Error: Action needs a type and a callback");
+        return false;
+    }
+    
+    // Same truncation as AlarmInfo::typeString, so loaded types match
+    char nombre[sizeof(AlarmInfo::typeString)];
+    strncpy(nombre, tipo, sizeof(nombre) - 1);
+    nombre[sizeof(nombre) - 1] = '\0';
+    
+    uint16_t idAccion = _findAction(nombre);
+    if (idAccion != NO_ACTION) {
+        // New callback for a registered type: alarms bound to it follow
+        ActionEntry& entrada = _actions[idAccion - 1];
+        entrada.kind = ACTION_EXTERNAL;
+        entrada.external = accion;
+    } else {
+        idAccion = _newAction();
+        if (idAccion == NO_ACTION) {
+            DBG_ALM("Error: Action table full");
+            return false;
+        }
+        
+        ActionEntry& entrada = _actions[idAccion - 1];
+        entrada = ActionEntry();
+        entrada.kind = ACTION_EXTERNAL;
+        entrada.external = accion;
+        entrada.hash = _hashType(nombre);
+        strcpy(entrada.type, nombre);
+        
+        size_t slot = entrada.hash % ACTION_SLOTS;
+        while (_actionSlots[slot] != NO_ACTION) slot = (slot + 1) % ACTION_SLOTS;
+        _actionSlots[slot] = idAccion;
+    }
+    
+    // Alarms of this type loaded before the registration had no callback
+    WriteSection section(*this);
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (_info[i].isCustomizable && _alarms[i].actionId == NO_ACTION &&
+            strcmp(_info[i].typeString, nombre) == 0) {
+            _setAction(_alarms[i], idAccion);
+        }
+    }
+    
+    DBG_ALM_PRINTF("Action registered - Type: %s, ID: %u", nombre, idAccion);
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+String BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerPersonalizablesJSON() {
+    // Serialized again only after a change. The copy returned belongs to the
+    // caller, so another task may publish a newer cache meanwhile
+    std::shared_ptr<const JsonCache> cache = _currentJsonCache();
+    if (!cache) {
+        // Built again if an edit on another task overlapped, so the cached
+        // list is one consistent version
+        std::shared_ptr<JsonCache> built = std::make_shared<JsonCache>();
+        uint32_t sequence;
+        do {
+            sequence = _readBegin();
+            built->text = "";
+            StringWriter writer(built->text);
+            _printCustomizablesJSON(writer, true);
+            built->version = _version;
+#ifdef ALARMSCHEDULER_STATS
+            built->fires = _firesTotal.load(std::memory_order_relaxed);
+#endif
+        } while (_readRetry(sequence));
+        cache = built;
+        std::atomic_store(&_jsonCache, cache);
+    }
+    return cache->text;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerPersonalizablesJSON(Print& salida) {
+    // The cache is held until written, even if a rebuild replaces it meanwhile
+    std::shared_ptr<const JsonCache> cache = _currentJsonCache();
+    if (cache) {
+        return salida.write((const uint8_t*)cache->text.c_str(), cache->text.length());
+    }
+    return _printCustomizablesJSON(salida, true);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerVersion() const {
+    return _readVersion();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+String BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerCambiosJSON(uint32_t desdeVersion) {
+    String result;
+    StringWriter writer(result);
+    obtenerCambiosJSON(desdeVersion, writer);
+    return result;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerCambiosJSON(uint32_t desdeVersion, Print& salida) {
+    // The version and the ring are copied together, so the alarms below are
+    // compared against one consistent list of changes
+    ChangeEntry changes[ALARMSCHEDULER_CHANGE_LOG];
+    size_t changeCount;
+    uint32_t version, changeFloor, sequence;
+    do {
+        sequence = _readBegin();
+        version = _version;
+        changeFloor = _changeFloor;
+        changeCount = _changeCount;
+        for (size_t k = 0; k < changeCount; k++) changes[k] = _changeAt(k);
+    } while (_readRetry(sequence));
+    
+    // Changes before the ring, a reload or clear(), or a version of another
+    // boot: the delta is unknown, so every alarm is sent ("full")
+    bool full = (desdeVersion < changeFloor || desdeVersion > version);
+    
+    size_t written = salida.print("{\"dataVersion\":");
+    written += salida.print(version);
+    written += salida.print(full ? ",\"full\":true" : ",\"full\":false");
+    written += salida.print(",\"changed\":[");
+    
+    JsonDocument element;
+    bool first = true;
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_fillAlarmJSON(element, i, true)) continue;
+        if (!full && !_changedSince(changes, changeCount, element["id"].as<int>(), desdeVersion)) continue;
+        
+        if (!first) written += salida.print(',');
+        first = false;
+        written += serializeJson(element, salida);
+    }
+    
+    // Web IDs changed since desdeVersion that no longer exist, each once
+    written += salida.print("],\"deleted\":[");
+    first = true;
+    for (size_t k = 0; k < changeCount && !full; k++) {
+        const ChangeEntry& change = changes[k];
+        if (change.version <= desdeVersion || _webIdLive(change.webId)) continue;
+        
+        bool listed = false;
+        for (size_t j = 0; j < k && !listed; j++) {
+            listed = (changes[j].version > desdeVersion && changes[j].webId == change.webId);
+        }
+        if (listed) continue;
+        
+        if (!first) written += salida.print(',');
+        first = false;
+        written += salida.print(change.webId);
+    }
+    
+    written += salida.print("]}");
+    return written;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerETag(char* buffer, size_t size) {
+    // Written into the caller's buffer, so readers on several tasks do not share one
+    uint32_t version = _readVersion();
+#ifdef ALARMSCHEDULER_STATS
+    // The list carries the execution statistics, which change without a new version
+    snprintf(buffer, size, "\"%08lx-%lu-%lu\"", (unsigned long)_bootId, (unsigned long)version,
+             (unsigned long)_firesTotal.load(std::memory_order_relaxed));
+#else
+    snprintf(buffer, size, "\"%08lx-%lu\"", (unsigned long)_bootId, (unsigned long)version);
+#endif
+    return buffer;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+String BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerEstadisticasJSON() {
+    String result;
+    StringWriter writer(result);
+    obtenerEstadisticasJSON(writer);
+    return result;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::obtenerEstadisticasJSON(Print& salida) {
+    JsonDocument doc;
+    
+    doc["module"] = "AlarmScheduler";
+    doc["version"] = "1.0";
+    doc["timestamp"] = millis();
+    
+    size_t system, customizable, enabled, disabled, total, stringsUsed;
+    int nextWebId;
+    uint32_t version, sequence;
+    
+    // Counted again if an edit on another task overlapped
+    do {
+        sequence = _readBegin();
+        system = customizable = enabled = disabled = 0;
+        for (IndexT i = 0; i < _slotEnd; i++) {
+            if (!_isLive(i)) continue;
+            if (_info[i].isCustomizable) {
+                customizable++;
+            } else {
+                system++;
+            }
+            
+            if (_alarms[i].enabled) {
+                enabled++;
+            } else {
+                disabled++;
+            }
+        }
+        total = _num;
+        nextWebId = _nextWebId;
+        version = _version;
+        stringsUsed = _stringsUsed;
+    } while (_readRetry(sequence));
+    
+    doc["totalAlarms"] = total;
+    doc["system"] = system;
+    doc["customizable"] = customizable;
+    doc["enabled"] = enabled;
+    doc["disabled"] = disabled;
+    doc["freeSpace"] = (size_t)(MAX_ALARMS - total);
+    doc["maxAlarms"] = (size_t)MAX_ALARMS;
+    doc["nextWebId"] = nextWebId;
+    doc["dataVersion"] = version;
+    doc["stringBytesUsed"] = stringsUsed;
+    doc["stringBytesTotal"] = (size_t)StringBytes;
+    doc["pendingSave"] = _pendingSave;
+#ifdef ALARMSCHEDULER_STATS
+    JsonObject loop = doc["loop"].to<JsonObject>();
+    loop["checks"] = _checkCalls;
+    loop["maxCheckUs"] = _maxCheckUs;
+    loop["maxGapMs"] = _maxCheckGapMs;
+    loop["gapsOverMinute"] = _checkGapsOverMinute;
+    _histogramJSON(loop["checkUs"].to<JsonObject>(), CHECK_TIME_BOUNDS, _checkTimeCounts, CHECK_TIME_BUCKETS);
+    _histogramJSON(loop["evaluated"].to<JsonObject>(), EVALUATED_BOUNDS, _evaluatedCounts, EVALUATED_BUCKETS);
+#endif
+    doc["commandQueueDepth"] = (size_t)ALARMSCHEDULER_COMMAND_QUEUE;
+    doc["commandsDropped"] = _commandsDropped.load(std::memory_order_relaxed);
+    doc["persistence"] = (_persistence == PERSIST_PER_ALARM) ? "perAlarm" : "snapshot";
+    doc["storeFile"] = _snapshotFile(_snapshotSlot < 0 ? 0 : _snapshotSlot);
+    doc["storeExists"] = _storage->exists(_snapshotFile(_snapshotSlot < 0 ? 0 : _snapshotSlot));
+    doc["storeSequence"] = _snapshotSequence;
+    doc["journalFile"] = JOURNAL_FILE;
+    doc["journalBytes"] = _journalBytes;
+    doc["jsonFile"] = JSON_FILE;
+    doc["fileExists"] = _storage->exists(JSON_FILE);
+    
+    struct tm timeinfo;
+    if (getLocalTime(&timeinfo)) {
+        doc["currentTime"]["valid"] = true;
+        doc["currentTime"]["hour"] = timeinfo.tm_hour;
+        doc["currentTime"]["minute"] = timeinfo.tm_min;
+        doc["currentTime"]["weekday"] = timeinfo.tm_wday;
+        doc["currentTime"]["yearday"] = timeinfo.tm_yday;
+    } else {
+        doc["currentTime"]["valid"] = false;
+    }
+    
+    return serializeJson(doc, salida);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::cargarPersonalizablesDesdeJSON() {
+    bool hadCustomizables = false;
+    for (IndexT i = 0; i < _slotEnd && !hadCustomizables; i++) {
+        hadCustomizables = _info[i].isCustomizable;
+    }
+    
+    // With customizable alarms in the table (an import after boot), the file
+    // is parsed twice: pass 1 checks it without touching the table, so a
+    // malformed file leaves the current alarms (and their saved copy) as they
+    // are. At boot there is nothing to protect, so the file is read once and
+    // whatever it added is removed again on error
+    int loaded = 0;
+    if (hadCustomizables && !_readAlarmsJSON(false, loaded)) {
+        return false;
+    }
+    
+    // Readers on other tasks wait for the whole list instead of a partial one
+    WriteSection section(*this);
+    _removeCustomizables();
+    _partialLoad = false;
+    bool ok = _readAlarmsJSON(true, loaded);
+    if (!ok && !hadCustomizables) {
+        // A missing file added nothing, so the table (and its version) is unchanged
+        if (loaded > 0) {
+            _removeCustomizables();
+            _partialLoad = false;
+            _noteReset();
+        }
+        return false;
+    }
+    
+    // The table no longer matches the snapshot: journal entries would not
+    // apply to it, so the next save writes a full snapshot. An import that did
+    // not fit is not saved on its own, so the file keeps the texts and alarms
+    // it lost; the first edit saves the table as it is
+    if (!_partialLoad) _markPendingSave();
+    _scheduleDirty = true;
+    _noteReset();
+    
+    DBG_ALM_PRINTF("Customizable alarms loaded: %d", loaded);
+    return ok;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_readAlarmsJSON(bool apply, int& loaded) {
+    const char* file = JSON_FILE;
+    
+    if (!_storage->openRead(file)) {
+        DBG_ALM("JSON alarm file doesn't exist");
+        return false;
+    }
+    Stream& f = _storage->reader();
+    
+    // Stream the "alarms" array one element at a time straight from the file,
+    // so memory use does not depend on the file size
+    if (!f.find("\"alarms\"") || !f.find("[")) {
+        DBG_ALM("Error parsing JSON: no alarms array");
+        _storage->closeRead();
+        return false;
+    }
+    
+    // Only the fields read below are kept in each element document
+    JsonDocument filter;
+    filter["id"] = true;
+    filter["name"] = true;
+    filter["description"] = true;
+    filter["day"] = true;
+    filter["hour"] = true;
+    filter["minute"] = true;
+    filter["action"] = true;
+    filter["enabled"] = true;
+    filter["parameter"] = true;
+    
+    JsonDocument element;
+    loaded = 0;
+    bool ok = true;
+    
+    while (isspace(f.peek())) f.read();
+    bool more = (f.peek() != ']');
+    
+    while (more) {
+        DeserializationError error = deserializeJson(element, f, DeserializationOption::Filter(filter));
+        if (error) {
+            DBG_ALM_PRINTF("Error parsing JSON: %s", error.c_str());
+            ok = false;
+            break;
+        }
+        more = f.findUntil(",", "]");
+        if (!apply) continue;
+        
+        JsonObject alarmObj = element.as<JsonObject>();
+        const char* name = alarmObj["name"] | "";
+        const char* description = alarmObj["description"] | "";
+        int day = alarmObj["day"] | 0;
+        uint8_t hour = alarmObj["hour"] | 0;
+        uint8_t minute = alarmObj["minute"] | 0;
+        const char* typeString = alarmObj["action"] | "SYSTEM";
+        bool enabled = alarmObj["enabled"] | true;
+        int webId = alarmObj["id"] | -1;
+        
+        if (strlen(name) == 0 || hour > 23 || minute > 59 || webId <= 0) {
+            DBG_ALM_PRINTF("Invalid alarm ignored: %s", name);
+            continue;
+        }
+        
+        uint8_t dayMask;
+        if (day == 0) {
+            dayMask = DOW_ALL;
+        } else {
+            dayMask = 1 << (day - 1);
+        }
+        
+        if (!_restoreCustomizable(webId, name, description, dayMask, hour, minute, 0,
+                                  typeString, enabled, alarmObj["parameter"] | 0)) {
+            break;
+        }
+        loaded++;
+        
+        DBG_ALM_PRINTF("Alarm loaded: %s (%s %02d:%02d)", 
+                      name, _dayToString(day).c_str(), hour, minute);
+    }
+    _storage->closeRead();
+    return ok;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::cargarPersonalizables() {
+    // Readers on other tasks wait for the whole list instead of a partial one
+    WriteSection section(*this);
+    
+    if (_persistence == PERSIST_PER_ALARM) {
+        if (_loadRecords()) {
+            _partialLoad = false;
+            _scheduleDirty = true;
+            _noteReset();
+            return true;
+        }
+        // First start in this mode: take over the snapshot and journal, if any
+        if (!_loadSnapshotAndJournal()) return false;
+        _markPendingSave();
+        return true;
+    }
+    return _loadSnapshotAndJournal();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_loadSnapshotAndJournal() {
+    if (_storage->exists(BINARY_FILE) || _storage->exists(BINARY_FILE_B)) {
+        if (!_loadSnapshot()) return false;
+    } else if (_storage->exists(JOURNAL_FILE)) {
+        // Edits made before the first snapshot was written
+        _removeCustomizables();
+        _journalBase = 0;
+    } else {
+        DBG_ALM("Binary alarm file doesn't exist");
+        return false;
+    }
+    
+    _replayJournal();
+    _partialLoad = false;   // the snapshot keeps what did not fit; journal edits apply to it
+    _scheduleDirty = true;
+    _noteReset();
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_loadSnapshot() {
+    // Only the headers of both slots are read; the newest one is checked and
+    // loaded, the other one only if the newest is damaged
+    int newest = _scanSnapshots();
+    if (newest < 0) {
+        _snapshotSlot = -1;
+        return false;
+    }
+    
+    for (int k = 0; k < 2; k++) {
+        int slot = (k == 0) ? newest : 1 - newest;
+        if (_loadSnapshotSlot(slot)) {
+            _snapshotSlot = slot;
+            return true;
+        }
+    }
+    _snapshotSlot = -1;
+    return false;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+AlarmStorage* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_defaultStorage() {
+    static SPIFFSAlarmStorage storage;
+    return &storage;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_snapshotFile(int slot) {
+    return slot ? BINARY_FILE_B : BINARY_FILE;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_readSnapshotHeader(BinaryHeader& header) {
+    if (_storage->read((uint8_t*)&header, BINARY_HEADER_V1) != BINARY_HEADER_V1 || header.magic != BINARY_MAGIC) {
+        return false;
+    }
+    
+    size_t headerSize = BINARY_HEADER_V1;
+    if (header.version == 1) {
+        header.sequence = 0;
+    } else if (header.version == BINARY_VERSION &&
+               _storage->read((uint8_t*)&header.sequence, sizeof(header.sequence)) == sizeof(header.sequence)) {
+        headerSize = sizeof(header);
+    } else {
+        return false;
+    }
+    
+    // A write cut short leaves fewer bytes than announced
+    return header.payloadBytes == _storage->size() - headerSize;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+int BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_scanSnapshots() {
+    int newest = -1;
+    _snapshotSequence = 0;
+    
+    for (int slot = 0; slot < 2; slot++) {
+        if (!_storage->openRead(_snapshotFile(slot))) continue;
+        
+        BinaryHeader header;
+        bool valid = _readSnapshotHeader(header);
+        _storage->closeRead();
+        if (!valid) continue;
+        
+        if (newest < 0 || header.sequence > _snapshotSequence) {
+            newest = slot;
+        }
+        if (header.sequence > _snapshotSequence) {
+            _snapshotSequence = header.sequence;
+        }
+    }
+    return newest;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_loadSnapshotSlot(int slot) {
+    if (!_storage->openRead(_snapshotFile(slot))) {
+        DBG_ALM("Binary alarm file doesn't exist");
+        return false;
+    }
+    
+    // Pass 1: header and CRC of the whole payload, before touching the table
+    BinaryHeader header;
+    if (!_readSnapshotHeader(header)) {
+        DBG_ALM_PRINTF("Binary alarm file %s: bad header", _snapshotFile(slot));
+        _storage->closeRead();
+        return false;
+    }
+    size_t headerSize = (header.version == 1) ? BINARY_HEADER_V1 : sizeof(header);
+    
+    uint8_t  chunk[64];
+    uint32_t crc = (header.version == 1) ? 0 : _crc32(0, (const uint8_t*)&header.sequence, sizeof(header.sequence));
+    size_t   left = header.payloadBytes;
+    while (left > 0) {
+        size_t n = _storage->read(chunk, left < sizeof(chunk) ? left : sizeof(chunk));
+        if (n == 0) break;
+        crc = _crc32(crc, chunk, n);
+        left -= n;
+    }
+    if (left != 0 || crc != header.crc) {
+        DBG_ALM_PRINTF("Binary alarm file %s: CRC mismatch", _snapshotFile(slot));
+        _storage->closeRead();
+        return false;
+    }
+    
+    // Pass 2: records straight into the table
+    _storage->seek(headerSize);
+    _removeCustomizables();
+    
+    uint16_t loaded = 0;
+    for (uint16_t r = 0; r < header.count; ++r) {
+        BinaryRecord record;
+        char name[MAX_NAME_LENGTH + 1];
+        char description[MAX_DESCRIPTION_LENGTH + 1];
+        
+        if (_storage->read((uint8_t*)&record, sizeof(record)) != sizeof(record) ||
+            record.nameLength > MAX_NAME_LENGTH || record.descriptionLength > MAX_DESCRIPTION_LENGTH ||
+            _storage->read((uint8_t*)name, record.nameLength) != record.nameLength ||
+            _storage->read((uint8_t*)description, record.descriptionLength) != record.descriptionLength) {
+            DBG_ALM("Binary alarm file: truncated record");
+            break;
+        }
+        name[record.nameLength] = '\0';
+        description[record.descriptionLength] = '\0';
+        
+        char typeString[sizeof(record.typeString) + 1];
+        memcpy(typeString, record.typeString, sizeof(record.typeString));
+        typeString[sizeof(record.typeString)] = '\0';
+        
+        if (!_restoreCustomizable(record.webId, name, description, record.dayMask, record.hour,
+                                  record.minute, record.intervalMin, typeString,
+                                  (record.flags & BINARY_FLAG_ENABLED) != 0, record.parameter)) {
+            break;
+        }
+        loaded++;
+    }
+    _storage->closeRead();
+    _journalBase = header.sequence;
+    
+    DBG_ALM_PRINTF("Customizable alarms loaded (binary, sequence %u): %u", (unsigned)header.sequence, loaded);
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::guardarPersonalizables() {
+    if (_persistence == PERSIST_PER_ALARM) {
+        if (!_saveRecords()) return false;
+        _pendingSave = false;
+        _partialLoad = false;
+        return true;
+    }
+    
+    BinaryHeader header;
+    header.magic        = BINARY_MAGIC;
+    header.version      = BINARY_VERSION;
+    header.count        = 0;
+    header.payloadBytes = 0;
+    
+    // Write the slot that does not hold the newest valid snapshot, so a reset
+    // mid-write still leaves that one to load
+    if (_snapshotSlot < 0) {
+        _snapshotSlot = _scanSnapshots();
+    }
+    int slot = (_snapshotSlot < 0) ? 0 : 1 - _snapshotSlot;
+    header.sequence = _snapshotSequence + 1;
+    header.crc      = _crc32(0, (const uint8_t*)&header.sequence, sizeof(header.sequence));
+    
+    // Size and CRC first, so the file is written in one sequential pass
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_info[i].isCustomizable) continue;
+        
+        BinaryRecord record;
+        _packRecord(i, record);
+        header.crc = _crc32(header.crc, (const uint8_t*)&record, sizeof(record));
+        header.crc = _crc32(header.crc, (const uint8_t*)getName(i), record.nameLength);
+        header.crc = _crc32(header.crc, (const uint8_t*)getDescription(i), record.descriptionLength);
+        header.payloadBytes += sizeof(record) + record.nameLength + record.descriptionLength;
+        header.count++;
+    }
+    
+    if (!_storage->openWrite(_snapshotFile(slot), false)) {
+        DBG_ALM("Error creating binary alarm file");
+        return false;
+    }
+    
+    size_t written = _storage->write((const uint8_t*)&header, sizeof(header));
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_info[i].isCustomizable) continue;
+        
+        BinaryRecord record;
+        _packRecord(i, record);
+        written += _storage->write((const uint8_t*)&record, sizeof(record));
+        written += _storage->write((const uint8_t*)getName(i), record.nameLength);
+        written += _storage->write((const uint8_t*)getDescription(i), record.descriptionLength);
+    }
+    
+    if (!_storage->closeWrite() || written != sizeof(header) + header.payloadBytes) {
+        DBG_ALM_PRINTF("Error writing binary alarm file: %u of %u bytes",
+                       (unsigned)written, (unsigned)(sizeof(header) + header.payloadBytes));
+        return false;
+    }
+    
+    DBG_ALM_PRINTF("Binary alarm file %s saved: %u alarms, %u bytes, sequence %u",
+                   _snapshotFile(slot), header.count, (unsigned)written, (unsigned)header.sequence);
+    _snapshotSlot = slot;
+    _snapshotSequence = header.sequence;
+    _journalBase = header.sequence;
+    
+    // The snapshot now holds every journaled edit (compaction). A cut before
+    // the removal leaves a journal based on the previous snapshot, skipped on load
+    _storage->remove(JOURNAL_FILE);
+    _journalBytes = 0;
+    
+    _pendingSave = false;
+    _partialLoad = false;
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::guardarPersonalizablesEnJSON() {
+    const char* file = JSON_FILE;
+    
+    if (!_storage->openWrite(file, false)) {
+        DBG_ALM("Error creating JSON file");
+        return false;
+    }
+    
+    size_t bytesWritten = _printCustomizablesJSON(_storage->writer(), false);
+    
+    if (!_storage->closeWrite() || bytesWritten == 0) {
+        DBG_ALM("Error writing JSON - 0 bytes written");
+        return false;
+    }
+    
+    DBG_ALM_PRINTF("JSON saved successfully: %u bytes", (unsigned)bytesWritten);
+    
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::guardarPendientes() {
+    // A JSON import that did not fit waits for an edit (see cargarPersonalizablesDesdeJSON)
+    if (!_pendingSave && (_journalBytes == 0 || _partialLoad)) return true;
+    
+    if (!guardarPersonalizables()) {
+        // Keep the changes pending and retry after another debounce window
+        _lastChangeMs = millis();
+        return false;
+    }
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::configurarAutoGuardado(bool habilitado, uint32_t esperaMs) {
+    _autoSave = habilitado;
+    _saveDebounceMs = esperaMs;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::hayCambiosPendientes() const {
+    return _pendingSave;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::configurarAlmacenamiento(AlarmStorage& almacenamiento) {
+    // Call before begin(): nothing is known yet about the files of the new backend
+    _storage = &almacenamiento;
+    _snapshotSlot = -1;
+    _snapshotSequence = 0;
+    _journalBase = 0;
+    _journalBytes = 0;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::configurarPersistencia(AlarmPersistence modo) {
+    // Call before begin(); with no per-alarm index yet, the snapshot is migrated on load
+    _persistence = modo;
+}
+
+// ============================================================================
+// CUSTOMIZABLE ALARM MANAGEMENT - ENGLISH ALIASES
+// ============================================================================
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::addCustomizable(const char* name, const char* description,
+                                                                           uint8_t dayMask, uint8_t hour, uint8_t minute,
+                                                                           const char* typeString, uint16_t parameter,
+                                                                           void (*callback)(uint16_t), bool enabled) {
+    return addPersonalizable(name, description, dayMask, hour, minute, typeString, parameter, callback, enabled);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::modifyCustomizable(int webId, const char* name, const char* description,
+                                                                            uint8_t dayMask, uint8_t hour, uint8_t minute,
+                                                                            const char* typeString, bool enabled,
+                                                                            void (*callback)(uint16_t), uint16_t parameter) {
+    return modificarPersonalizable(webId, name, description, dayMask, hour, minute, typeString, enabled, callback, parameter);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::deleteCustomizable(int webId) {
+    return eliminarPersonalizable(webId);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::enableCustomizable(int webId, bool state) {
+    return habilitarPersonalizable(webId, state);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::postAddCustomizable(const char* name, const char* description,
+                                                                             uint8_t dayMask, uint8_t hour, uint8_t minute,
+                                                                             const char* typeString, uint16_t parameter,
+                                                                             void (*callback)(uint16_t), bool enabled) {
+    return encolarAltaPersonalizable(name, description, dayMask, hour, minute, typeString, parameter, callback, enabled);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::postModifyCustomizable(int webId, const char* name, const char* description,
+                                                                                uint8_t dayMask, uint8_t hour, uint8_t minute,
+                                                                                const char* typeString, bool enabled,
+                                                                                void (*callback)(uint16_t), uint16_t parameter) {
+    return encolarModificacionPersonalizable(webId, name, description, dayMask, hour, minute, typeString, enabled, callback, parameter);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::postDeleteCustomizable(int webId) {
+    return encolarEliminacionPersonalizable(webId);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::postEnableCustomizable(int webId, bool state) {
+    return encolarHabilitacionPersonalizable(webId, state);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getDroppedCommands() const {
+    return comandosDescartados();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::setCommandNotify(void (*notify)()) {
+    configurarAvisoComando(notify);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+String BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getCustomizablesJSON() {
+    return obtenerPersonalizablesJSON();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+String BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getStatisticsJSON() {
+    return obtenerEstadisticasJSON();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getCustomizablesJSON(Print& out) {
+    return obtenerPersonalizablesJSON(out);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getStatisticsJSON(Print& out) {
+    return obtenerEstadisticasJSON(out);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getVersion() const {
+    return obtenerVersion();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getETag(char* buffer, size_t size) {
+    return obtenerETag(buffer, size);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+String BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getChangesJSON(uint32_t sinceVersion) {
+    return obtenerCambiosJSON(sinceVersion);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::getChangesJSON(uint32_t sinceVersion, Print& out) {
+    return obtenerCambiosJSON(sinceVersion, out);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::loadCustomizablesFromJSON() {
+    return cargarPersonalizablesDesdeJSON();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::saveCustomizablesToJSON() {
+    return guardarPersonalizablesEnJSON();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::registerAction(const char* type, void (*action)(uint16_t)) {
+    return registrarAccion(type, action);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::loadCustomizables() {
+    return cargarPersonalizables();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::saveCustomizables() {
+    return guardarPersonalizables();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::flush() {
+    return guardarPendientes();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::setAutoSave(bool enabled, uint32_t debounceMs) {
+    configurarAutoGuardado(enabled, debounceMs);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::hasPendingChanges() const {
+    return hayCambiosPendientes();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::setStorage(AlarmStorage& storage) {
+    configurarAlmacenamiento(storage);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::setPersistence(AlarmPersistence mode) {
+    configurarPersistencia(mode);
+}
+
+// ============================================================================
+// PRIVATE HELPER METHODS
+// ============================================================================
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint8_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_dayMaskFromWeekday(int weekday) {
+    return (weekday >= 0 && weekday <= 6) ? (1 << weekday) : 0;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_isDue(const Alarm& alarm) const {
+    uint8_t currentHour     = t.tm_hour;
+    uint8_t currentMinute   = t.tm_min;
+    uint8_t currentDayMask  = _dayMaskFromWeekday(t.tm_wday);
+    int     currentYearDay  = t.tm_yday;
+    
+    if (!alarm.enabled) return false;
+    if (!(alarm.dayMask & currentDayMask)) return false;
+
+    // Interval alarm logic: on the day's anchor + k * interval grid, once per
+    // minute (the repeated hour at DST end has the same wall-clock minutes)
+    if (alarm.intervalMin > 0) {
+        int minuteOfDay = currentHour * 60 + currentMinute;
+        if ((minuteOfDay - _intervalAnchor(alarm)) % alarm.intervalMin != 0) return false;
+        return !(alarm.lastYearDay == currentYearDay &&
+                 alarm.lastHour    == currentHour &&
+                 alarm.lastMinute  == currentMinute);
+    }
+    
+    // Fixed/wildcard alarm logic
+    bool matchHour = (alarm.hour == ALARM_WILDCARD || alarm.hour == currentHour);
+    bool matchMinute = (alarm.minute == ALARM_WILDCARD || alarm.minute == currentMinute);
+    if (!matchHour || !matchMinute) return false;
+    
+    bool alreadyExecuted = false;
+    
+    if (alarm.hour == ALARM_WILDCARD) {
+        alreadyExecuted = (alarm.lastYearDay == currentYearDay && 
+                          alarm.lastMinute == currentMinute &&
+                          alarm.lastHour == currentHour);
+    } else {
+        alreadyExecuted = (alarm.lastYearDay == currentYearDay && 
+                          alarm.lastMinute == currentMinute);
+    }
+    
+    return !alreadyExecuted;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_dispatch(IndexT idx) {
+    Alarm &alarm = _alarms[idx];
+    if (alarm.actionId == NO_ACTION) return;
+    
+    const ActionEntry& action = _actions[alarm.actionId - 1];
+    switch (action.kind) {
+        case ACTION_METHOD:
+            (this->*action.method)(alarm.parameter);
+            DBG_ALM_PRINTF("[ALARM] idx=%u executed - member method, param=%u\n", idx, alarm.parameter);
+            break;
+        case ACTION_EXTERNAL:
+            action.external(alarm.parameter);
+            DBG_ALM_PRINTF("[ALARM] idx=%u executed - external function, param=%u\n", idx, alarm.parameter);
+            break;
+        case ACTION_EXTERNAL0:
+            action.external0();
+            DBG_ALM_PRINTF("[ALARM] idx=%u executed - external function no params\n", idx);
+            break;
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_hashType(const char* type) {
+    uint32_t hash = 2166136261UL;      // FNV-1a
+    while (*type) {
+        hash = (hash ^ (uint8_t)*type++) * 16777619UL;
+    }
+    return hash;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint16_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_findAction(const char* type) const {
+    if (type == nullptr || *type == '\0') return NO_ACTION;
+    
+    uint32_t hash = _hashType(type);
+    for (size_t slot = hash % ACTION_SLOTS; _actionSlots[slot] != NO_ACTION; slot = (slot + 1) % ACTION_SLOTS) {
+        const ActionEntry& action = _actions[_actionSlots[slot] - 1];
+        if (action.hash == hash && strcmp(action.type, type) == 0) {
+            return _actionSlots[slot];
+        }
+    }
+    return NO_ACTION;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint16_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_newAction() {
+    // An unnamed entry no alarm uses any more is taken before a new one
+    for (uint16_t i = 0; i < _actionCount; i++) {
+        if (_actions[i].type[0] == '\0' && _actions[i].refs == 0) return i + 1;
+    }
+    if (_actionCount >= MAX_ACTIONS) return NO_ACTION;
+    return ++_actionCount;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint16_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_internAction(const ActionEntry& action) {
+    // Unnamed entries are shared by every alarm using the same callback
+    for (uint16_t i = 0; i < _actionCount; i++) {
+        const ActionEntry& entry = _actions[i];
+        if (entry.type[0] != '\0' || entry.kind != action.kind) continue;
+        if ((action.kind == ACTION_METHOD    && entry.method    == action.method) ||
+            (action.kind == ACTION_EXTERNAL  && entry.external  == action.external) ||
+            (action.kind == ACTION_EXTERNAL0 && entry.external0 == action.external0)) {
+            return i + 1;
+        }
+    }
+    
+    // Unused until _setAction() gives it an alarm
+    uint16_t actionId = _newAction();
+    if (actionId == NO_ACTION) return NO_ACTION;
+    ActionEntry& entry = _actions[actionId - 1];
+    entry = action;
+    entry.type[0] = '\0';
+    entry.refs = 0;
+    return actionId;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_setAction(Alarm& alarm, uint16_t actionId) {
+    // References are counted for every entry, but only unnamed ones are freed:
+    // registered types stay for alarms loaded later
+    if (actionId != NO_ACTION) _actions[actionId - 1].refs++;
+    if (alarm.actionId != NO_ACTION) _actions[alarm.actionId - 1].refs--;
+    alarm.actionId = actionId;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint16_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_bindAction(const char* type, void (*callback)(uint16_t)) {
+    uint16_t actionId = _findAction(type);
+    if (callback == nullptr) return actionId;
+    
+    if (actionId != NO_ACTION) {
+        const ActionEntry& registered = _actions[actionId - 1];
+        if (registered.kind == ACTION_EXTERNAL && registered.external == callback) return actionId;
+    }
+    
+    ActionEntry entry = {};
+    entry.kind = ACTION_EXTERNAL;
+    entry.external = callback;
+    return _internAction(entry);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_rebuildSchedule(time_t now) {
+    time_t minuteStart = now - t.tm_sec;
+    
+    _heapSize = 0;
+    for (IndexT i = 0; i < _slotEnd; ++i) {
+        Alarm &alarm = _alarms[i];
+        alarm.nextFire = 0;
+        if (!alarm.enabled || _isFixedTime(alarm) || _isSliced(alarm)) continue;  // plan / bit-planes
+        
+        alarm.nextFire = _computeNextFire(alarm, minuteStart);
+        if (alarm.nextFire != 0) {
+            _heap[_heapSize++] = i;
+        }
+    }
+    
+    for (int pos = _heapSize / 2 - 1; pos >= 0; --pos) {
+        _heapSiftDown(pos);
+    }
+    
+    _compilePlan(now);
+#ifdef ALARMSCHEDULER_BITSLICED
+    _buildSlices();
+    _sliceNextMinute = 0;  // match the current minute right away
+#endif
+    
+    _scheduleDirty = false;
+    DBG_ALM_PRINTF("[ALARM] Queue rebuilt: %u of %u alarms scheduled, %u planned today",
+                   _heapSize, _num, _planSize);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_isFixedTime(const Alarm& alarm) {
+    return alarm.intervalMin == 0 && alarm.hour != ALARM_WILDCARD && alarm.minute != ALARM_WILDCARD;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_isSliced(const Alarm& alarm) {
+#ifdef ALARMSCHEDULER_BITSLICED
+    return alarm.intervalMin == 0 && !_isFixedTime(alarm);
+#else
+    (void)alarm;
+    return false;
+#endif
+}
+
+#ifdef ALARMSCHEDULER_BITSLICED
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_buildSlices() {
+    memset(_sliceEnabled, 0, sizeof(_sliceEnabled));
+    memset(_sliceDay, 0, sizeof(_sliceDay));
+    memset(_sliceHourAny, 0, sizeof(_sliceHourAny));
+    memset(_sliceHour, 0, sizeof(_sliceHour));
+    memset(_sliceMinuteAny, 0, sizeof(_sliceMinuteAny));
+    memset(_sliceMinute, 0, sizeof(_sliceMinute));
+    _sliceUsed = false;
+    
+    for (IndexT i = 0; i < _slotEnd; ++i) {
+        const Alarm &alarm = _alarms[i];
+        if (!alarm.enabled || !_isSliced(alarm)) continue;
+        
+        size_t   w   = i / 32;
+        uint32_t bit = 1UL << (i % 32);
+        _sliceEnabled[w] |= bit;
+        _sliceUsed = true;
+        
+        for (int d = 0; d < 7; ++d) {
+            if (alarm.dayMask & (1 << d)) _sliceDay[d][w] |= bit;
+        }
+        
+        if (alarm.hour == ALARM_WILDCARD) {
+            _sliceHourAny[w] |= bit;
+        } else {
+            for (int b = 0; b < 5; ++b) {
+                if (alarm.hour & (1 << b)) _sliceHour[b][w] |= bit;
+            }
+        }
+        
+        if (alarm.minute == ALARM_WILDCARD) {
+            _sliceMinuteAny[w] |= bit;
+        } else {
+            for (int b = 0; b < 6; ++b) {
+                if (alarm.minute & (1 << b)) _sliceMinute[b][w] |= bit;
+            }
+        }
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_matchSlices(IndexT dueCount) {
+    // Per bit, a plane matches where it equals that bit of the current value
+    uint32_t hourFlip[5], minuteFlip[6];
+    for (int b = 0; b < 5; ++b) hourFlip[b]   = (t.tm_hour & (1 << b)) ? 0 : 0xFFFFFFFFUL;
+    for (int b = 0; b < 6; ++b) minuteFlip[b] = (t.tm_min  & (1 << b)) ? 0 : 0xFFFFFFFFUL;
+    
+    for (size_t w = 0; w < SLICE_WORDS; ++w) {
+        uint32_t hourMatch = 0xFFFFFFFFUL;
+        for (int b = 0; b < 5; ++b) hourMatch &= _sliceHour[b][w] ^ hourFlip[b];
+        
+        uint32_t minuteMatch = 0xFFFFFFFFUL;
+        for (int b = 0; b < 6; ++b) minuteMatch &= _sliceMinute[b][w] ^ minuteFlip[b];
+        
+        uint32_t due = _sliceEnabled[w] & _sliceDay[t.tm_wday][w] &
+                       (hourMatch | _sliceHourAny[w]) & (minuteMatch | _sliceMinuteAny[w]);
+        
+        while (due) {
+            _due[dueCount++] = (IndexT)(w * 32 + __builtin_ctz(due));
+            due &= due - 1;
+        }
+    }
+    
+    return dueCount;
+}
+#endif
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_compilePlan(time_t now) {
+    uint8_t  todayMask = _dayMaskFromWeekday(t.tm_wday);
+    uint16_t nowMinute = t.tm_hour * 60 + t.tm_min;
+    
+    _planSize = 0;
+    for (IndexT i = 0; i < _slotEnd; ++i) {
+        const Alarm &alarm = _alarms[i];
+        if (!alarm.enabled || !_isFixedTime(alarm) || !(alarm.dayMask & todayMask)) continue;
+        
+        // Already ran today (rebuild after a change or clock step)
+        if (alarm.lastYearDay == t.tm_yday && alarm.lastHour == alarm.hour &&
+            alarm.lastMinute == alarm.minute) continue;
+        
+        // Times inside a DST gap do not exist today and never fire
+        if (_localToEpoch(t, alarm.hour, alarm.minute) == 0) continue;
+        
+        // Insertion by minute only: equal minutes keep array order
+        uint16_t minuteOfDay = alarm.hour * 60 + alarm.minute;
+        IndexT j = _planSize++;
+        for (; j > 0 && _plan[j - 1].minuteOfDay > minuteOfDay; --j) {
+            _plan[j] = _plan[j - 1];
+        }
+        _plan[j].minuteOfDay = minuteOfDay;
+        _plan[j].index = i;
+    }
+    
+    _planCursor = 0;
+    while (_planCursor < _planSize && _plan[_planCursor].minuteOfDay < nowMinute) {
+        ++_planCursor;
+    }
+    
+    _planDay = t.tm_year * 366 + t.tm_yday;
+    _updatePlanNextFire(now);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_updatePlanNextFire(time_t now) {
+    time_t minuteStart = now - t.tm_sec;
+    
+    if (_planCursor < _planSize) {
+        uint16_t minuteOfDay = _plan[_planCursor].minuteOfDay;
+        _planNextFire = _localToEpoch(t, minuteOfDay / 60, minuteOfDay % 60);
+        
+        // Repeated hour at DST end: the first occurrence has passed but the
+        // wall clock has not reached the entry yet, so look again each minute
+        if (_planNextFire <= minuteStart && minuteOfDay > t.tm_hour * 60 + t.tm_min) {
+            _planNextFire = minuteStart + 60;
+        }
+        return;
+    }
+    
+    // Today is done: wake for the first fixed alarm of a later day, which
+    // also triggers compiling that day's plan
+    _planNextFire = 0;
+    for (IndexT i = 0; i < _slotEnd; ++i) {
+        const Alarm &alarm = _alarms[i];
+        if (!alarm.enabled || !_isFixedTime(alarm)) continue;
+        
+        time_t next = _findNextMatch(alarm.dayMask, alarm.hour, alarm.minute, minuteStart + 60);
+        if (next != 0 && (_planNextFire == 0 || next < _planNextFire)) {
+            _planNextFire = next;
+        }
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+time_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_computeNextFire(const Alarm& alarm, time_t from) const {
+    if (alarm.intervalMin > 0) {
+        return _findNextInterval(alarm, from);
+    }
+    
+    // Fixed/wildcard alarm
+    return _findNextMatch(alarm.dayMask, alarm.hour, alarm.minute, from);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+time_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_findNextInterval(const Alarm& alarm, time_t from) {
+    struct tm base;
+    localtime_r(&from, &base);
+    
+    long interval = alarm.intervalMin;
+    long anchor   = _intervalAnchor(alarm);
+    long start    = _localMinuteIndex(base);  // wall-clock minute of 'from'
+    long baseDay  = start / 1440;
+    
+    // First grid point at or after 'from', computed arithmetically
+    long idx = _nextGridMinute(start, anchor, interval);
+    
+    // Skip grid points on masked-out days or inside a DST gap; a year covers
+    // every day mask / interval combination that can ever match
+    while (idx - start < 366L * 1440) {
+        long day = idx / 1440;
+        int  weekday = (int)((base.tm_wday + (day - baseDay)) % 7);
+        
+        if (!(alarm.dayMask & _dayMaskFromWeekday(weekday))) {
+            idx = _nextGridMinute((day + 1) * 1440, anchor, interval);
+            continue;
+        }
+        
+        // Normalized calendar date of that day (noon is never inside a DST gap)
+        struct tm date = {};
+        date.tm_year  = base.tm_year;
+        date.tm_mon   = base.tm_mon;
+        date.tm_mday  = base.tm_mday + (int)(day - baseDay);
+        date.tm_hour  = 12;
+        date.tm_isdst = -1;
+        mktime(&date);
+        
+        time_t epoch = _localToEpoch(date, (idx % 1440) / 60, idx % 60);
+        if (epoch != 0) {
+            return (epoch < from) ? from : epoch;
+        }
+        idx = _nextGridMinute(idx + 1, anchor, interval);
+    }
+    
+    return 0;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+long BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_intervalAnchor(const Alarm& alarm) {
+    // Wildcards anchor at zero: hour wildcard = every hour's grid, minute wildcard = :00
+    long hour   = (alarm.hour   == ALARM_WILDCARD) ? 0 : alarm.hour;
+    long minute = (alarm.minute == ALARM_WILDCARD) ? 0 : alarm.minute;
+    return hour * 60 + minute;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+long BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_nextGridMinute(long minute, long anchor, long interval) {
+    // The grid starts again every day, so the anchor itself fires every day
+    // even when the interval does not divide 1440; the last step of a day
+    // may then be shorter than the interval
+    long day    = minute / 1440;
+    long offset = minute % 1440;
+    long next   = offset + ((anchor - offset) % interval + interval) % interval;
+    if (next < 1440) return day * 1440 + next;
+    return (day + 1) * 1440 + anchor % interval;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+long BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_localMinuteIndex(const struct tm& local) {
+    // Wall-clock minutes since 1970-01-01 00:00 local (days from civil date)
+    long     y   = local.tm_year + 1900 - (local.tm_mon < 2 ? 1 : 0);
+    unsigned m   = local.tm_mon + 1;
+    long     era = (y >= 0 ? y : y - 399) / 400;
+    unsigned yoe = (unsigned)(y - era * 400);
+    unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + local.tm_mday - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    long     days = era * 146097 + (long)doe - 719468;
+    
+    return days * 1440 + local.tm_hour * 60 + local.tm_min;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+time_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_findNextMatch(uint8_t dayMask, uint8_t hour, uint8_t minute, time_t from) {
+    struct tm base;
+    localtime_r(&from, &base);
+    
+    int firstMinute = base.tm_hour * 60 + base.tm_min;
+    
+    // A full week plus today covers every day mask
+    for (int d = 0; d < 8; ++d) {
+        if (!(dayMask & _dayMaskFromWeekday((base.tm_wday + d) % 7))) continue;
+        
+        // Normalized calendar date for day d (noon is never inside a DST gap)
+        struct tm day = {};
+        day.tm_year  = base.tm_year;
+        day.tm_mon   = base.tm_mon;
+        day.tm_mday  = base.tm_mday + d;
+        day.tm_hour  = 12;
+        day.tm_isdst = -1;
+        mktime(&day);
+        
+        int start = (d == 0) ? firstMinute : 0;
+        int hFrom = (hour == ALARM_WILDCARD) ? start / 60 : hour;
+        int hTo   = (hour == ALARM_WILDCARD) ? 23 : hour;
+        
+        for (int h = hFrom; h <= hTo; ++h) {
+            int mMin  = (h * 60 < start) ? start - h * 60 : 0;
+            int mFrom = (minute == ALARM_WILDCARD) ? mMin : minute;
+            int mTo   = (minute == ALARM_WILDCARD) ? 59 : minute;
+            
+            for (int m = (mFrom < mMin ? 60 : mFrom); m <= mTo; ++m) {
+                time_t epoch = _localToEpoch(day, h, m);
+                if (epoch != 0) {
+                    return (epoch < from) ? from : epoch;
+                }
+            }
+        }
+    }
+    
+    return 0;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+time_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_localToEpoch(const struct tm& day, uint8_t hour, uint8_t minute) {
+    // Try both DST flags so ambiguous times (DST end) resolve to the earliest
+    // occurrence and missing times (DST start) are rejected
+    time_t best = 0;
+    
+    for (int dst = 0; dst <= 1; ++dst) {
+        struct tm c = {};
+        c.tm_year  = day.tm_year;
+        c.tm_mon   = day.tm_mon;
+        c.tm_mday  = day.tm_mday;
+        c.tm_hour  = hour;
+        c.tm_min   = minute;
+        c.tm_isdst = dst;
+        
+        time_t epoch = mktime(&c);
+        if (epoch == (time_t)-1) continue;
+        
+        struct tm check;
+        localtime_r(&epoch, &check);
+        if (check.tm_yday != day.tm_yday || check.tm_hour != hour || check.tm_min != minute) continue;
+        
+        if (best == 0 || epoch < best) best = epoch;
+    }
+    
+    return best;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_heapLess(IndexT a, IndexT b) const {
+    // Ties keep array order so same-minute alarms fire as they were added
+    if (_alarms[a].nextFire != _alarms[b].nextFire) {
+        return _alarms[a].nextFire < _alarms[b].nextFire;
+    }
+    return a < b;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_heapPush(IndexT idx) {
+    IndexT pos = _heapSize++;
+    _heap[pos] = idx;
+    
+    while (pos > 0) {
+        IndexT parent = (pos - 1) / 2;
+        if (!_heapLess(_heap[pos], _heap[parent])) return;
+        
+        IndexT tmp  = _heap[pos];
+        _heap[pos]    = _heap[parent];
+        _heap[parent] = tmp;
+        pos = parent;
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_heapSiftDown(IndexT pos) {
+    while (true) {
+        IndexT smallest = pos;
+        size_t left  = 2 * (size_t)pos + 1;
+        size_t right = 2 * (size_t)pos + 2;
+        
+        if (left  < _heapSize && _heapLess(_heap[left],  _heap[smallest])) smallest = (IndexT)left;
+        if (right < _heapSize && _heapLess(_heap[right], _heap[smallest])) smallest = (IndexT)right;
+        if (smallest == pos) return;
+        
+        IndexT tmp     = _heap[pos];
+        _heap[pos]      = _heap[smallest];
+        _heap[smallest] = tmp;
+        pos = smallest;
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_string(uint16_t offset) const {
+    return (offset == AlarmInfo::NO_STRING) ? "" : &_strings[offset];
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_stringCost(const char* text, size_t maxLength) {
+    if (text == nullptr || text[0] == '\0') return 0;  // empty strings take no space
+    size_t length = strlen(text);
+    return ((length > maxLength) ? maxLength : length) + 1;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_stringsFit(const AlarmInfo& info, const char* name,
+                                                                     const char* description) const {
+    size_t needed = _stringCost(name, MAX_NAME_LENGTH) + _stringCost(description, MAX_DESCRIPTION_LENGTH);
+    size_t held   = _stringCost(_string(info.nameOffset), MAX_NAME_LENGTH) +
+                    _stringCost(_string(info.descriptionOffset), MAX_DESCRIPTION_LENGTH);
+    
+    if (_stringsUsed - held + needed > StringBytes) {
+        DBG_ALM_PRINTF("String arena full: %u used, %u needed", (unsigned)_stringsUsed, (unsigned)needed);
+        return false;
+    }
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_setStrings(AlarmInfo& info, const char* name,
+                                                                     const char* description) {
+    if (!_stringsFit(info, name, description)) return false;
+    
+    // Inputs may point into the arena (e.g. getName() passed back), and
+    // releasing the old strings moves it, so copy them out first
+    char nameCopy[MAX_NAME_LENGTH + 1];
+    char descriptionCopy[MAX_DESCRIPTION_LENGTH + 1];
+    strncpy(nameCopy, name ? name : "", MAX_NAME_LENGTH);
+    nameCopy[MAX_NAME_LENGTH] = '\0';
+    strncpy(descriptionCopy, description ? description : "", MAX_DESCRIPTION_LENGTH);
+    descriptionCopy[MAX_DESCRIPTION_LENGTH] = '\0';
+    
+    _releaseString(info.nameOffset);
+    _releaseString(info.descriptionOffset);
+    info.nameOffset        = _storeString(nameCopy);
+    info.descriptionOffset = _storeString(descriptionCopy);
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_fitStrings(AlarmInfo& info, const char* name,
+                                                                     const char* description) {
+    // Loads keep every alarm: when the arena is full the description is cut
+    // first, then the name, and _partialLoad records that text was lost
+    char nameCopy[MAX_NAME_LENGTH + 1];
+    char descriptionCopy[MAX_DESCRIPTION_LENGTH + 1];
+    strncpy(nameCopy, name ? name : "", MAX_NAME_LENGTH);
+    nameCopy[MAX_NAME_LENGTH] = '\0';
+    strncpy(descriptionCopy, description ? description : "", MAX_DESCRIPTION_LENGTH);
+    descriptionCopy[MAX_DESCRIPTION_LENGTH] = '\0';
+    
+    size_t nameLength = strlen(nameCopy);
+    size_t descriptionLength = strlen(descriptionCopy);
+    size_t held = _stringCost(_string(info.nameOffset), MAX_NAME_LENGTH) +
+                  _stringCost(_string(info.descriptionOffset), MAX_DESCRIPTION_LENGTH);
+    size_t room = StringBytes - (_stringsUsed - held);
+    
+    if (nameLength + 1 > room) nameLength = (room > 1) ? room - 1 : 0;
+    room -= (nameLength > 0) ? nameLength + 1 : 0;
+    if (descriptionLength + 1 > room) descriptionLength = (room > 1) ? room - 1 : 0;
+    
+    if (nameLength < strlen(nameCopy) || descriptionLength < strlen(descriptionCopy)) {
+        DBG_ALM_PRINTF("String arena full: text of alarm \"%s\" shortened", nameCopy);
+        nameCopy[nameLength] = '\0';
+        descriptionCopy[descriptionLength] = '\0';
+        _partialLoad = true;
+    }
+    return _setStrings(info, nameCopy, descriptionCopy);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint16_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_storeString(const char* text) {
+    if (text[0] == '\0') return AlarmInfo::NO_STRING;
+    
+    size_t size = strlen(text) + 1;
+    uint16_t offset = (uint16_t)_stringsUsed;
+    memcpy(&_strings[offset], text, size);
+    _stringsUsed += size;
+    return offset;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_releaseString(uint16_t& offset) {
+    if (offset == AlarmInfo::NO_STRING) return;
+    
+    // Compact: close the gap and shift every offset stored after it
+    size_t start = offset;
+    size_t size  = strlen(&_strings[start]) + 1;
+    memmove(&_strings[start], &_strings[start + size], _stringsUsed - start - size);
+    _stringsUsed -= size;
+    offset = AlarmInfo::NO_STRING;
+    
+    for (IndexT i = 0; i < _slotEnd; ++i) {
+        AlarmInfo& info = _info[i];
+        if (info.nameOffset != AlarmInfo::NO_STRING && info.nameOffset > start) {
+            info.nameOffset -= size;
+        }
+        if (info.descriptionOffset != AlarmInfo::NO_STRING && info.descriptionOffset > start) {
+            info.descriptionOffset -= size;
+        }
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_isLive(IndexT idx) const {
+    return idx < _slotEnd && (_generation[idx] & 1);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_nextSlot() const {
+    if (_freeHead != INVALID_INDEX) return _freeHead;
+    return (_slotEnd < MAX_ALARMS) ? _slotEnd : INVALID_INDEX;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_claimSlot(IndexT idx) {
+    // idx comes from _nextSlot(), filled in by the caller
+    if (idx == _freeHead) {
+        _freeHead = _nextFree[idx];
+    } else {
+        _slotEnd = idx + 1;
+    }
+    _generation[idx]++;
+    _num++;
+#ifdef ALARMSCHEDULER_STATS
+    _stats[idx] = AlarmStats();
+#endif
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_rebuildFreeList() {
+    while (_slotEnd > 0 && !_isLive(_slotEnd - 1)) {
+        _slotEnd--;
+    }
+    
+    _freeHead = INVALID_INDEX;
+    for (IndexT i = _slotEnd; i-- > 0; ) {
+        if (_isLive(i)) continue;
+        _nextFree[i] = _freeHead;
+        _freeHead = i;
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_webIdHome(int webId) {
+    return ((uint32_t)webId * 2654435761UL) % WEBID_SLOTS;     // Fibonacci hashing
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_indexWebId(IndexT idx) {
+    if (_webIdIndexDirty) return;
+    
+    size_t pos = _webIdHome(_info[idx].webId);
+    while (_webIdIndex[pos] != INVALID_INDEX) {
+        pos = (pos + 1) % WEBID_SLOTS;
+    }
+    _webIdIndex[pos] = idx;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_unindexWebId(IndexT idx) {
+    if (_webIdIndexDirty) return;
+    
+    size_t hole = _webIdHome(_info[idx].webId);
+    while (_webIdIndex[hole] != idx) {
+        if (_webIdIndex[hole] == INVALID_INDEX) return;
+        hole = (hole + 1) % WEBID_SLOTS;
+    }
+    
+    // Backward shift: move back every entry of the run that can no longer be
+    // reached from its home position once the hole is there
+    for (size_t pos = (hole + 1) % WEBID_SLOTS; _webIdIndex[pos] != INVALID_INDEX; pos = (pos + 1) % WEBID_SLOTS) {
+        size_t home = _webIdHome(_info[_webIdIndex[pos]].webId);
+        bool reachable = (hole < pos) ? (home > hole && home <= pos) : (home > hole || home <= pos);
+        if (!reachable) {
+            _webIdIndex[hole] = _webIdIndex[pos];
+            hole = pos;
+        }
+    }
+    _webIdIndex[hole] = INVALID_INDEX;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_rebuildWebIdIndex() {
+    for (size_t pos = 0; pos < WEBID_SLOTS; pos++) {
+        _webIdIndex[pos] = INVALID_INDEX;
+    }
+    _webIdIndexDirty = false;
+    
+    // getInfoMutable() may have changed web IDs: keep new ones above them
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_info[i].isCustomizable) continue;
+        _indexWebId(i);
+        if (_info[i].webId >= _nextWebId) {
+            _nextWebId = _info[i].webId + 1;
+        }
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_removeAlarm(IndexT idx) {
+    _releaseString(_info[idx].nameOffset);
+    _releaseString(_info[idx].descriptionOffset);
+    if (_info[idx].isCustomizable) _unindexWebId(idx);
+    _setAction(_alarms[idx], NO_ACTION);
+    
+    // The other alarms keep their index: the slot goes on the free list
+    _alarms[idx] = Alarm();
+    _info[idx]   = AlarmInfo();
+    _generation[idx]++;
+    _nextFree[idx] = _freeHead;
+    _freeHead = idx;
+    _num--;
+    _scheduleDirty = true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_removeCustomizables() {
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (_info[i].isCustomizable) {
+            _removeAlarm(i);
+        }
+    }
+    _rebuildFreeList();     // reloaded alarms fill the slots in ascending order
+    _scheduleDirty = true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_restoreCustomizable(int webId, const char* name,
+                                                                              const char* description,
+                                                                              uint8_t dayMask, uint8_t hour,
+                                                                              uint8_t minute, uint16_t intervalMin,
+                                                                              const char* typeString, bool enabled,
+                                                                              uint16_t parameter) {
+    IndexT idx = _nextSlot();
+    if (idx == INVALID_INDEX) {
+        DBG_ALM("Maximum alarms reached, ignoring remaining");
+        _partialLoad = true;
+        return false;
+    }
+    
+    Alarm& alarm = _alarms[idx];
+    AlarmInfo& info = _info[idx];
+    _fitStrings(info, name, description);
+    
+    // Callbacks are not persisted: the alarm runs the action registered for its type
+    alarm.enabled = enabled;
+    alarm.dayMask = dayMask;
+    alarm.hour = hour;
+    alarm.minute = minute;
+    alarm.intervalMin = intervalMin;
+    alarm.parameter = parameter;
+    
+    strncpy(info.typeString, typeString, sizeof(info.typeString) - 1);
+    info.typeString[sizeof(info.typeString) - 1] = '\0';
+    _setAction(alarm, _findAction(info.typeString));
+    
+    info.isCustomizable = true;
+    info.webId = webId;
+    
+    if (webId >= _nextWebId) {
+        _nextWebId = webId + 1;
+    }
+    
+    _claimSlot(idx);
+    _indexWebId(idx);
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_packRecord(IndexT idx, BinaryRecord& record) const {
+    const Alarm& alarm = _alarms[idx];
+    const AlarmInfo& info = _info[idx];
+    
+    memset(&record, 0, sizeof(record));
+    record.webId             = info.webId;
+    record.parameter         = alarm.parameter;
+    record.intervalMin       = alarm.intervalMin;
+    record.dayMask           = alarm.dayMask;
+    record.hour              = alarm.hour;
+    record.minute            = alarm.minute;
+    record.flags             = alarm.enabled ? BINARY_FLAG_ENABLED : 0;
+    memcpy(record.typeString, info.typeString, sizeof(record.typeString));  // 19 of the 20 chars
+    record.nameLength        = (uint8_t)strlen(getName(idx));
+    record.descriptionLength = (uint8_t)strlen(getDescription(idx));
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_replayJournal() {
+    _journalBytes = 0;
+    
+    if (!_storage->openRead(JOURNAL_FILE)) return;
+    
+    size_t   size = _storage->size();
+    uint8_t  payload[JOURNAL_MAX_PAYLOAD];
+    uint16_t applied = 0;
+    uint32_t base = _journalBase;   // a journal without BASE follows the loaded snapshot
+    
+    while (_journalBytes < size) {
+        JournalEntry entry;
+        if (!_readEntry(entry, payload)) {
+            // Torn tail (power cut during an append): drop it, and write a new
+            // snapshot so later entries are not appended after the damage
+            DBG_ALM_PRINTF("Alarm journal: damaged entry at byte %u ignored", (unsigned)_journalBytes);
+            _markPendingSave();
+            break;
+        }
+        
+        if (entry.op == JOURNAL_BASE && entry.length == sizeof(base)) {
+            memcpy(&base, payload, sizeof(base));
+        } else if (base >= _journalBase) {
+            _applyJournalEntry(entry.op, payload, entry.length);
+            applied++;
+        }
+        _journalBytes += sizeof(entry) + entry.length;
+    }
+    _storage->closeRead();
+    
+    if (base < _journalBase) {
+        // Written before the loaded snapshot, which already holds its edits
+        DBG_ALM_PRINTF("Alarm journal of snapshot %u is stale, removed", (unsigned)base);
+        _storage->remove(JOURNAL_FILE);
+        _journalBytes = 0;
+        return;
+    }
+    
+    DBG_ALM_PRINTF("Alarm journal replayed: %u entries, %u bytes", applied, (unsigned)_journalBytes);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_applyJournalEntry(uint8_t op, const uint8_t* payload, size_t length) {
+    if (op == JOURNAL_PUT && length >= sizeof(BinaryRecord)) {
+        BinaryRecord record;
+        memcpy(&record, payload, sizeof(record));
+        if (record.nameLength > MAX_NAME_LENGTH || record.descriptionLength > MAX_DESCRIPTION_LENGTH ||
+            length != sizeof(record) + record.nameLength + record.descriptionLength) {
+            return;
+        }
+        
+        char name[MAX_NAME_LENGTH + 1];
+        char description[MAX_DESCRIPTION_LENGTH + 1];
+        char typeString[sizeof(record.typeString) + 1];
+        memcpy(name, payload + sizeof(record), record.nameLength);
+        name[record.nameLength] = '\0';
+        memcpy(description, payload + sizeof(record) + record.nameLength, record.descriptionLength);
+        description[record.descriptionLength] = '\0';
+        memcpy(typeString, record.typeString, sizeof(record.typeString));
+        typeString[sizeof(record.typeString)] = '\0';
+        
+        IndexT idx = _findIndexByWebId(record.webId);
+        if (idx == INVALID_INDEX) {
+            _restoreCustomizable(record.webId, name, description, record.dayMask, record.hour,
+                                 record.minute, record.intervalMin, typeString,
+                                 (record.flags & BINARY_FLAG_ENABLED) != 0, record.parameter);
+            return;
+        }
+        
+        // Modified alarm: update in place so the table order is kept
+        Alarm& alarm = _alarms[idx];
+        AlarmInfo& info = _info[idx];
+        _fitStrings(info, name, description);
+        alarm.enabled = (record.flags & BINARY_FLAG_ENABLED) != 0;
+        alarm.dayMask = record.dayMask;
+        alarm.hour = record.hour;
+        alarm.minute = record.minute;
+        alarm.intervalMin = record.intervalMin;
+        alarm.parameter = record.parameter;
+        memcpy(info.typeString, typeString, sizeof(info.typeString));  // terminated above
+        _setAction(alarm, _findAction(info.typeString));  // the type may have changed
+    } else if ((op == JOURNAL_DELETE || op == JOURNAL_ENABLE) && length == sizeof(JournalState)) {
+        JournalState state;
+        memcpy(&state, payload, sizeof(state));
+        
+        IndexT idx = _findIndexByWebId(state.webId);
+        if (idx == INVALID_INDEX) return;
+        
+        if (op == JOURNAL_DELETE) {
+            _removeAlarm(idx);
+        } else {
+            _alarms[idx].enabled = (state.flags & BINARY_FLAG_ENABLED) != 0;
+        }
+    }
+    // Unknown operations are skipped
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_printCustomizablesJSON(Print& out, bool webFields) {
+    size_t customizable;
+    uint32_t sequence;
+    do {
+        sequence = _readBegin();
+        customizable = 0;
+        for (IndexT i = 0; i < _slotEnd; i++) {
+            if (_info[i].isCustomizable) {
+                customizable++;
+            }
+        }
+    } while (_readRetry(sequence));
+    
+    // The envelope is printed by hand and each alarm serialized on its own, so
+    // memory stays at one alarm's document whatever the number of alarms
+    size_t written = out.print("{\"version\":\"1.0\",\"timestamp\":");
+    written += out.print(millis());
+    written += out.print(",\"total\":");
+    written += out.print(customizable);
+    written += out.print(",\"alarms\":[");
+    
+    JsonDocument element;
+    bool first = true;
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_fillAlarmJSON(element, i, webFields)) continue;
+        
+        if (!first) written += out.print(',');
+        first = false;
+        written += serializeJson(element, out);
+    }
+    
+    written += out.print("]}");
+    return written;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_fillAlarmJSON(JsonDocument& element, IndexT idx, bool webFields) {
+    // Copied first: an edit on another task may change the alarm or move the
+    // strings while the document is built
+    Alarm alarm;
+    AlarmInfo info;
+    char name[MAX_NAME_LENGTH + 1];
+    char description[MAX_DESCRIPTION_LENGTH + 1];
+#ifdef ALARMSCHEDULER_STATS
+    AlarmStats stats;               // written by check(), outside the sequence
+#endif
+    uint32_t sequence;
+    do {
+        sequence = _readBegin();
+        alarm = _alarms[idx];
+        info = _info[idx];
+#ifdef ALARMSCHEDULER_STATS
+        stats = _stats[idx];
+#endif
+        _copyString(info.nameOffset, name, sizeof(name));
+        _copyString(info.descriptionOffset, description, sizeof(description));
+    } while (_readRetry(sequence));
+    
+    if (!info.isCustomizable) return false;
+    
+    int day = 0;
+    if (alarm.dayMask != DOW_ALL) {
+        for (int d = 0; d < 7; d++) {
+            if (alarm.dayMask & (1 << d)) {
+                day = d + 1;
+                break;
+            }
+        }
+    }
+    
+    element.clear();
+    element["id"] = info.webId;
+    element["name"] = name;
+    element["description"] = description;
+    element["day"] = day;
+    if (webFields) {
+        element["dayName"] = _dayToString(day);
+    }
+    element["hour"] = alarm.hour;
+    element["minute"] = alarm.minute;
+    element["action"] = info.typeString;
+    if (webFields) {
+        element["parameter"] = alarm.parameter;
+        element["enabled"] = alarm.enabled;
+        
+        char timeFormatted[8];
+        sprintf(timeFormatted, "%02d:%02d", alarm.hour, alarm.minute);
+        element["timeText"] = timeFormatted;
+        element["arrayIndex"] = idx;
+#ifdef ALARMSCHEDULER_STATS
+        JsonObject statsJson = element["stats"].to<JsonObject>();
+        statsJson["fires"] = stats.fires;
+        statsJson["lastUs"] = stats.lastMicros;
+        statsJson["maxUs"] = stats.maxMicros;
+        statsJson["lastLateMs"] = stats.lastLateMs;
+        statsJson["maxLateMs"] = stats.maxLateMs;
+#endif
+    } else {
+        element["enabled"] = alarm.enabled;
+        element["parameter"] = alarm.parameter;
+    }
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_postCommand(CommandOp op, int webId, const char* name, const char* description,
+                                                                     uint8_t dayMask, uint8_t hour, uint8_t minute, const char* typeString,
+                                                                     uint16_t parameter, void (*callback)(uint16_t), bool enabled) {
+    // Claim a cell: the tail only moves while the queue has room
+    uint32_t tail = _commandTail.load(std::memory_order_relaxed);
+    do {
+        if (tail - _commandHead.load(std::memory_order_acquire) >= ALARMSCHEDULER_COMMAND_QUEUE) {
+            _commandsDropped.fetch_add(1, std::memory_order_relaxed);
+            DBG_ALM("Error: Command queue full");
+            return false;
+        }
+    } while (!_commandTail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed));
+    
+    CommandCell& cell = _commands[tail % ALARMSCHEDULER_COMMAND_QUEUE];
+    Command& command = cell.command;
+    command.op = op;
+    command.webId = webId;
+    command.dayMask = dayMask;
+    command.hour = hour;
+    command.minute = minute;
+    command.parameter = parameter;
+    command.callback = callback;
+    command.enabled = enabled;
+    strncpy(command.type, typeString ? typeString : "", sizeof(command.type) - 1);
+    command.type[sizeof(command.type) - 1] = '\0';
+    strncpy(command.name, name ? name : "", sizeof(command.name) - 1);
+    command.name[sizeof(command.name) - 1] = '\0';
+    strncpy(command.description, description ? description : "", sizeof(command.description) - 1);
+    command.description[sizeof(command.description) - 1] = '\0';
+    
+    cell.ready.store(true, std::memory_order_release);
+    
+    // A loop() sleeping for msHastaProximaAlarma() would apply it only then
+    void (*notify)() = _commandNotify.load(std::memory_order_acquire);
+    if (notify) notify();
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_drainCommands() {
+    uint32_t head = _commandHead.load(std::memory_order_relaxed);
+    CommandCell* cell = &_commands[head % ALARMSCHEDULER_COMMAND_QUEUE];
+    if (!cell->ready.load(std::memory_order_acquire)) return;
+    
+    // Several edits at once: one snapshot after the debounce window instead of
+    // a journal entry each
+    if (_persistence == PERSIST_SNAPSHOT &&
+        _commands[(head + 1) % ALARMSCHEDULER_COMMAND_QUEUE].ready.load(std::memory_order_acquire)) {
+        _markPendingSave();
+    }
+    
+    // Stops at a cell still being written, so commands apply in posting order
+    while (cell->ready.load(std::memory_order_acquire)) {
+        const Command& command = cell->command;
+        switch (command.op) {
+            case COMMAND_ADD:
+                addPersonalizable(command.name, command.description, command.dayMask, command.hour,
+                                  command.minute, command.type, command.parameter, command.callback,
+                                  command.enabled);
+                break;
+            case COMMAND_MODIFY:
+                modificarPersonalizable(command.webId, command.name, command.description, command.dayMask,
+                                        command.hour, command.minute, command.type, command.enabled,
+                                        command.callback, command.parameter);
+                break;
+            case COMMAND_DELETE:
+                eliminarPersonalizable(command.webId);
+                break;
+            case COMMAND_ENABLE:
+                habilitarPersonalizable(command.webId, command.enabled);
+                break;
+        }
+        
+        cell->ready.store(false, std::memory_order_relaxed);
+        _commandHead.store(++head, std::memory_order_release);
+        cell = &_commands[head % ALARMSCHEDULER_COMMAND_QUEUE];
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+std::shared_ptr<const typename BasicAlarmScheduler<Capacity, IndexT, StringBytes>::JsonCache>
+BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_currentJsonCache() const {
+    std::shared_ptr<const JsonCache> cache = std::atomic_load(&_jsonCache);
+    if (!cache || cache->version != _readVersion()) return nullptr;
+#ifdef ALARMSCHEDULER_STATS
+    if (cache->fires != _firesTotal.load(std::memory_order_relaxed)) return nullptr;
+#endif
+    return cache;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_readVersion() const {
+    // _version is written inside edits, which may run on another task
+    uint32_t version, sequence;
+    do {
+        sequence = _readBegin();
+        version = _version;
+    } while (_readRetry(sequence));
+    return version;
+}
+
+#ifdef ALARMSCHEDULER_STATS
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_checkStarted() {
+    uint32_t nowMs = millis();
+    if (_checkCalls > 0) {
+        uint32_t gap = nowMs - _lastCheckMs;
+        if (gap > _maxCheckGapMs) _maxCheckGapMs = gap;
+        if (gap >= 60000) _checkGapsOverMinute++;
+    }
+    _lastCheckMs = nowMs;
+    _checkEvaluated = 0;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_checkFinished(uint32_t elapsedUs) {
+    _checkCalls++;
+    if (elapsedUs > _maxCheckUs) _maxCheckUs = elapsedUs;
+    _checkTimeCounts[_bucket(elapsedUs, CHECK_TIME_BOUNDS, CHECK_TIME_BUCKETS - 1)]++;
+    _evaluatedCounts[_bucket(_checkEvaluated, EVALUATED_BOUNDS, EVALUATED_BUCKETS - 1)]++;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_bucket(uint32_t value, const uint32_t* bounds, size_t boundCount) {
+    // First bound at or above value; past the last one, the overflow bucket
+    size_t bucket = 0;
+    while (bucket < boundCount && value > bounds[bucket]) bucket++;
+    return bucket;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_histogramJSON(JsonObject out, const uint32_t* bounds, const uint32_t* counts, size_t buckets) {
+    // "upTo": inclusive upper bound of each bucket but the last, which holds the rest
+    JsonArray upTo = out["upTo"].to<JsonArray>();
+    for (size_t b = 0; b + 1 < buckets; b++) upTo.add(bounds[b]);
+    JsonArray countArray = out["counts"].to<JsonArray>();
+    for (size_t b = 0; b < buckets; b++) countArray.add(counts[b]);
+}
+#endif
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_beginWrite() {
+    // Only the outermost section moves the sequence (loads call the editors)
+    if (_writeDepth++ > 0) return;
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_endWrite() {
+    if (--_writeDepth > 0) return;
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_readBegin() const {
+    uint32_t sequence = _sequence.load(std::memory_order_acquire);
+    while (sequence & 1) {
+        delay(1);           // edit open: let the editing task finish it
+        sequence = _sequence.load(std::memory_order_acquire);
+    }
+    return sequence;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_readRetry(uint32_t sequence) const {
+    // The copies made since _readBegin() are valid only if no edit started
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return _sequence.load(std::memory_order_relaxed) != sequence;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_copyString(uint16_t offset, char* buffer, size_t size) const {
+    // Bounded: a copy that overlapped an edit may hold any offset, and is
+    // thrown away by _readRetry()
+    size_t length = 0;
+    if (offset != AlarmInfo::NO_STRING) {
+        while (offset + length < StringBytes && length + 1 < size && _strings[offset + length] != '\0') {
+            buffer[length] = _strings[offset + length];
+            length++;
+        }
+    }
+    buffer[length] = '\0';
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_webIdLive(int webId) const {
+    // Scanned rather than looked up: the web ID index is rebuilt lazily, which
+    // a reader on another task must not do
+    bool live;
+    uint32_t sequence;
+    do {
+        sequence = _readBegin();
+        live = false;
+        for (IndexT i = 0; i < _slotEnd && !live; i++) {
+            live = (_info[i].isCustomizable && _info[i].webId == webId);
+        }
+    } while (_readRetry(sequence));
+    return live;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_noteChange(int webId) {
+    _version++;
+    
+    // Ring full: the oldest change is dropped, so deltas must start at or after it
+    if (_changeCount == ALARMSCHEDULER_CHANGE_LOG) {
+        _changeFloor = _changeAt(0).version;
+        _changeCount--;
+    }
+    _changes[_changeHead].version = _version;
+    _changes[_changeHead].webId = webId;
+    _changeHead = (_changeHead + 1) % ALARMSCHEDULER_CHANGE_LOG;
+    _changeCount++;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_noteReset() {
+    // Change not tied to one alarm (load, clear(), direct access): no delta spans it
+    _version++;
+    _changeFloor = _version;
+    _changeCount = 0;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_changedSince(const ChangeEntry* changes, size_t count,
+                                                                       int webId, uint32_t version) {
+    for (size_t k = 0; k < count; k++) {
+        if (changes[k].version > version && changes[k].webId == webId) return true;
+    }
+    return false;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const typename BasicAlarmScheduler<Capacity, IndexT, StringBytes>::ChangeEntry&
+BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_changeAt(size_t position) const {
+    return _changes[(_changeHead + ALARMSCHEDULER_CHANGE_LOG - _changeCount + position) % ALARMSCHEDULER_CHANGE_LOG];
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_persistPut(IndexT idx, bool added) {
+    // No auto-save, a full save already pending, or a JSON import cut short
+    // (no snapshot holds it): a full save will hold this change
+    if (!_autoSave || _pendingSave || _partialLoad) {
+        _markPendingSave();
+        return;
+    }
+    
+    uint8_t payload[JOURNAL_MAX_PAYLOAD];
+    size_t length = _packPut(idx, payload);
+    
+    if (_persistence == PERSIST_SNAPSHOT) {
+        _appendJournal(JOURNAL_PUT, payload, length);
+        return;
+    }
+    
+    // Index first: a reset before the record is written leaves a listed but
+    // missing record, which loading skips and repairs with a full save
+    char path[RECORD_PATH_LENGTH];
+    if ((added && !_storeIndex()) ||
+        !_writeEntry(_recordFile(_info[idx].webId, path), false, JOURNAL_PUT, payload, length)) {
+        DBG_ALM("Error writing alarm record, full save pending");
+        _markPendingSave();
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_persistState(uint8_t op, int webId, bool enabled) {
+    if (!_autoSave || _pendingSave || _partialLoad) {
+        _markPendingSave();
+        return;
+    }
+    
+    if (_persistence == PERSIST_SNAPSHOT) {
+        JournalState state;
+        state.webId = webId;
+        state.flags = enabled ? BINARY_FLAG_ENABLED : 0;
+        _appendJournal(op, (const uint8_t*)&state, sizeof(state));
+        return;
+    }
+    
+    if (op == JOURNAL_ENABLE) {
+        // The flag lives in the record: rewrite that record only
+        _persistPut(_findIndexByWebId(webId), false);
+        return;
+    }
+    
+    // Record first, same reasoning as in _persistPut()
+    char path[RECORD_PATH_LENGTH];
+    if (!_storage->remove(_recordFile(webId, path)) || !_storeIndex()) {
+        DBG_ALM("Error deleting alarm record, full save pending");
+        _markPendingSave();
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_packPut(IndexT idx, uint8_t* payload) {
+    BinaryRecord record;
+    _packRecord(idx, record);
+    
+    memcpy(payload, &record, sizeof(record));
+    memcpy(payload + sizeof(record), getName(idx), record.nameLength);
+    memcpy(payload + sizeof(record) + record.nameLength, getDescription(idx), record.descriptionLength);
+    
+    return sizeof(record) + record.nameLength + record.descriptionLength;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_appendJournal(uint8_t op, const uint8_t* payload, size_t length) {
+    // A new journal starts with the snapshot it follows (truncating any stale one)
+    if (_journalBytes == 0) {
+        if (!_writeEntry(JOURNAL_FILE, false, JOURNAL_BASE, (const uint8_t*)&_journalBase, sizeof(_journalBase))) {
+            DBG_ALM("Error creating alarm journal, snapshot pending");
+            _markPendingSave();
+            return;
+        }
+        _journalBytes = sizeof(JournalEntry) + sizeof(_journalBase);
+    }
+    
+    if (!_writeEntry(JOURNAL_FILE, true, op, payload, length)) {
+        DBG_ALM("Error appending to alarm journal, snapshot pending");
+        _markPendingSave();
+        return;
+    }
+    
+    _journalBytes += sizeof(JournalEntry) + length;
+    if (_journalBytes >= JOURNAL_COMPACT_BYTES) {
+        // Compact: the debounced save rewrites the snapshot and drops the journal
+        _markPendingSave();
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_writeEntry(const char* path, bool append, uint8_t op,
+                                                                     const uint8_t* payload, size_t length) {
+    uint8_t buffer[sizeof(JournalEntry) + JOURNAL_MAX_PAYLOAD];
+    JournalEntry entry;
+    entry.op = op;
+    entry.length = length;
+    entry.crc = _crc32(_crc32(0, &entry.op, sizeof(entry.op) + sizeof(entry.length)), payload, length);
+    memcpy(buffer, &entry, sizeof(entry));
+    memcpy(buffer + sizeof(entry), payload, length);
+    
+    // One write per entry: a power cut leaves at most one torn entry at the end
+    size_t written = 0;
+    if (_storage->openWrite(path, append)) {
+        written = _storage->write(buffer, sizeof(entry) + length);
+        if (!_storage->closeWrite()) written = 0;
+    }
+    return written == sizeof(entry) + length;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_readEntry(JournalEntry& entry, uint8_t* payload) {
+    if (_storage->read((uint8_t*)&entry, sizeof(entry)) != sizeof(entry) ||
+        entry.length > JOURNAL_MAX_PAYLOAD ||
+        _storage->read(payload, entry.length) != entry.length) {
+        return false;
+    }
+    uint32_t crc = _crc32(0, &entry.op, sizeof(entry.op) + sizeof(entry.length));
+    return _crc32(crc, payload, entry.length) == entry.crc;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+const char* BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_recordFile(int webId, char* path) {
+    snprintf(path, RECORD_PATH_LENGTH, "%s%d", RECORD_FILE_PREFIX, webId);
+    return path;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_saveRecords() {
+    uint8_t payload[JOURNAL_MAX_PAYLOAD];
+    char    path[RECORD_PATH_LENGTH];
+    
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_info[i].isCustomizable) continue;
+        
+        size_t length = _packPut(i, payload);
+        if (!_writeEntry(_recordFile(_info[i].webId, path), false, JOURNAL_PUT, payload, length)) {
+            DBG_ALM_PRINTF("Error writing alarm record %s", path);
+            return false;
+        }
+    }
+    
+    // Records listed in the old index but no longer in the table (deleted
+    // while auto-save was off or failing)
+    int32_t webIds[16];
+    size_t  n;
+    for (size_t pos = 0; (n = _readIndexChunk(pos, webIds, 16)) > 0; pos += n) {
+        for (size_t k = 0; k < n; k++) {
+            if (_findIndexByWebId(webIds[k]) == INVALID_INDEX) {
+                _storage->remove(_recordFile(webIds[k], path));
+            }
+        }
+    }
+    
+    if (!_storeIndex()) return false;
+    
+    // Snapshot mode files, superseded once migrated
+    _storage->remove(BINARY_FILE);
+    _storage->remove(BINARY_FILE_B);
+    _storage->remove(JOURNAL_FILE);
+    _snapshotSlot = -1;
+    _snapshotSequence = 0;
+    _journalBase = 0;
+    _journalBytes = 0;
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_storeIndex() {
+    JournalEntry entry;
+    entry.op = RECORD_INDEX;
+    entry.length = 0;
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (_info[i].isCustomizable) entry.length += sizeof(int32_t);
+    }
+    
+    // CRC first, so the index is written in one sequential pass
+    entry.crc = _crc32(0, &entry.op, sizeof(entry.op) + sizeof(entry.length));
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_info[i].isCustomizable) continue;
+        int32_t webId = _info[i].webId;
+        entry.crc = _crc32(entry.crc, (const uint8_t*)&webId, sizeof(webId));
+    }
+    
+    if (!_storage->openWrite(RECORD_INDEX_FILE, false)) {
+        DBG_ALM("Error creating alarm index");
+        return false;
+    }
+    size_t written = _storage->write((const uint8_t*)&entry, sizeof(entry));
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_info[i].isCustomizable) continue;
+        int32_t webId = _info[i].webId;
+        written += _storage->write((const uint8_t*)&webId, sizeof(webId));
+    }
+    
+    if (!_storage->closeWrite() || written != sizeof(entry) + entry.length) {
+        DBG_ALM("Error writing alarm index");
+        return false;
+    }
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+size_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_readIndexChunk(size_t position, int32_t* webIds, size_t maxCount) {
+    // The index is reopened per chunk: only one file is open for reading at a
+    // time, and each record is read between chunks
+    if (!_storage->openRead(RECORD_INDEX_FILE)) return 0;
+    
+    JournalEntry entry;
+    size_t n = 0;
+    if (_storage->read((uint8_t*)&entry, sizeof(entry)) == sizeof(entry) && entry.op == RECORD_INDEX) {
+        size_t count = (_storage->size() - sizeof(entry)) / sizeof(int32_t);
+        if (position < count && _storage->seek(sizeof(entry) + position * sizeof(int32_t))) {
+            n = (count - position < maxCount) ? count - position : maxCount;
+            if (_storage->read((uint8_t*)webIds, n * sizeof(int32_t)) != n * sizeof(int32_t)) n = 0;
+        }
+    }
+    _storage->closeRead();
+    return n;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+bool BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_loadRecords() {
+    if (!_storage->openRead(RECORD_INDEX_FILE)) return false;
+    
+    // Pass 1: framing and CRC of the index, before touching the table
+    JournalEntry entry;
+    bool     valid = _storage->read((uint8_t*)&entry, sizeof(entry)) == sizeof(entry) &&
+                     entry.op == RECORD_INDEX && entry.length % sizeof(int32_t) == 0 &&
+                     entry.length == _storage->size() - sizeof(entry);
+    uint8_t  chunk[64];
+    uint32_t crc = _crc32(0, &entry.op, sizeof(entry.op) + sizeof(entry.length));
+    size_t   left = entry.length;
+    while (valid && left > 0) {
+        size_t n = _storage->read(chunk, left < sizeof(chunk) ? left : sizeof(chunk));
+        if (n == 0) break;
+        crc = _crc32(crc, chunk, n);
+        left -= n;
+    }
+    _storage->closeRead();
+    if (!valid || left != 0 || crc != entry.crc) {
+        DBG_ALM("Alarm index: damaged");
+        return false;
+    }
+    
+    // Pass 2: each listed record, CRC-checked, straight into the table
+    _removeCustomizables();
+    
+    uint8_t  payload[JOURNAL_MAX_PAYLOAD];
+    char     path[RECORD_PATH_LENGTH];
+    int32_t  webIds[16];
+    size_t   n;
+    uint16_t loaded = 0;
+    for (size_t pos = 0; (n = _readIndexChunk(pos, webIds, 16)) > 0; pos += n) {
+        for (size_t k = 0; k < n; k++) {
+            JournalEntry record;
+            int32_t webId = 0;
+            bool ok = _storage->openRead(_recordFile(webIds[k], path)) &&
+                      _readEntry(record, payload) && record.op == JOURNAL_PUT &&
+                      record.length >= sizeof(webId);
+            _storage->closeRead();
+            if (ok) {
+                memcpy(&webId, payload, sizeof(webId));
+                if (webId == webIds[k]) {
+                    _applyJournalEntry(JOURNAL_PUT, payload, record.length);
+                }
+                ok = (_findIndexByWebId(webIds[k]) != INVALID_INDEX);
+            }
+            if (!ok) {
+                // Missing or torn record: drop it, and rewrite index and records
+                DBG_ALM_PRINTF("Alarm record %s: damaged, ignored", path);
+                _markPendingSave();
+                continue;
+            }
+            loaded++;
+        }
+    }
+    
+    DBG_ALM_PRINTF("Customizable alarms loaded (per alarm): %u", loaded);
+    return true;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+uint32_t BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_crc32(uint32_t crc, const uint8_t* data, size_t length) {
+    // CRC-32 (IEEE 802.3, reflected), bitwise: no table in RAM or flash
+    crc = ~crc;
+    while (length--) {
+        crc ^= *data++;
+        for (int b = 0; b < 8; ++b) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_markPendingSave() {
+    _pendingSave = true;
+    _lastChangeMs = millis();
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+IndexT BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_findIndexByWebId(int webId) {
+    if (_webIdIndexDirty) _rebuildWebIdIndex();
+    
+    for (size_t pos = _webIdHome(webId); _webIdIndex[pos] != INVALID_INDEX; pos = (pos + 1) % WEBID_SLOTS) {
+        IndexT idx = _webIdIndex[pos];
+        if (_info[idx].webId == webId) {
+            return idx;
+        }
+    }
+    return INVALID_INDEX;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+int BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_generateNewWebId() {
+    // IDs are not reused within a session, so a delta feed never sees a
+    // deleted ID come back as a different alarm
+    if (_webIdIndexDirty) _rebuildWebIdIndex();
+    return _nextWebId++;
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+String BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_dayToString(int day) {
+    switch (day) {
+        case 0: return "Every day";
+        case 1: return "Sunday";
+        case 2: return "Monday";
+        case 3: return "Tuesday";
+        case 4: return "Wednesday";
+        case 5: return "Thursday";
+        case 6: return "Friday";
+        case 7: return "Saturday";
+        default: return "Invalid day";
+    }
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::_createDefaultCustomizableAlarms() {
+    DBG_ALM("Not creating default alarms - will be created from web interface");
+}
+
+template <size_t Capacity, typename IndexT, size_t StringBytes>
+void BasicAlarmScheduler<Capacity, IndexT, StringBytes>::printAllAlarms() {
+    Serial.println("\n========== ALARM LIST ==========");
+    Serial.printf("Total registered alarms: %u/%u\n", (unsigned)_num, (unsigned)MAX_ALARMS);
+    Serial.printf("Next Web ID: %d\n", _nextWebId);
+    Serial.println();
+    
+    if (_num == 0) {
+        Serial.println("No alarms registered");
+        return;
+    }
+    
+    for (IndexT i = 0; i < _slotEnd; i++) {
+        if (!_isLive(i)) continue;
+        const Alarm& alarm = _alarms[i];
+        const AlarmInfo& info = _info[i];
+        
+        Serial.printf("========== ALARM INDEX: %u ==========\n", (unsigned)i);
+        Serial.printf("Web ID: %d\n", info.webId);
+        Serial.printf("Name: '%s'\n", _string(info.nameOffset));
+        Serial.printf("Description: '%s'\n", _string(info.descriptionOffset));
+        Serial.printf("Type: '%s'\n", info.typeString);
+        Serial.printf("Customizable: %s\n", info.isCustomizable ? "YES" : "NO");
+        Serial.printf("Hour: %u\n", alarm.hour);
+        Serial.printf("Minute: %u\n", alarm.minute);
+        Serial.printf("Interval (min): %u\n", alarm.intervalMin);
+        Serial.printf("Day Mask: 0x%02X\n", alarm.dayMask);
+        Serial.printf("Enabled: %s\n", alarm.enabled ? "YES" : "NO");
+        Serial.printf("Parameter: %u\n", alarm.parameter);
+        Serial.printf("Has callback: %s\n", alarm.actionId != NO_ACTION ? "YES" : "NO");
+#ifdef ALARMSCHEDULER_STATS
+        const AlarmStats& stats = _stats[i];
+        Serial.printf("Fired: %lu times, callback last/max %lu/%lu us, late last/max %u/%u ms\n",
+                      (unsigned long)stats.fires, (unsigned long)stats.lastMicros,
+                      (unsigned long)stats.maxMicros, stats.lastLateMs, stats.maxLateMs);
+#endif
+        Serial.println();
+    }
+    
+    Serial.println("========== END ALARM LIST ==========\n");
+}
+
+#endif // ALARMSCHEDULER_IMPL_H
@@ -0,0 +1,242 @@
+/**
+ * @file AlarmStorage.h
+ * @brief Storage backends for the persistence of customizable alarms
+ *
+ * @details AlarmScheduler does not call a file system directly; every read and
+ *          write of the snapshots, the journal and the JSON export goes through
+ *          an AlarmStorage, selected with setStorage() before begin():
+ *
+ *          - FSAlarmStorage: any fs::FS (SPIFFS, LittleFS, FFat, SD)
+ *          - SPIFFSAlarmStorage: FSAlarmStorage on SPIFFS, the default
+ *          - LittleFSAlarmStorage: see AlarmStorageLittleFS.h
+ *          - NVSAlarmStorage: see AlarmStorageNVS.h (Preferences blobs)
+ *          - RAMAlarmStorage: see AlarmStorageRAM.h (volatile, host tests)
+ *
+ *          One file is open for reading and one for writing at a time. Backends
+ *          without files (NVS, RAM) derive from BufferedAlarmStorage, which
+ *          keeps the open file in a heap buffer and stores it whole on
+ *          closeWrite().
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ * @version 1.0.0
+ */
+
+#ifndef ALARMSTORAGE_H
+#define ALARMSTORAGE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <SPIFFS.h>
+
+/**
+ * @brief Storage backend interface
+ */
+class AlarmStorage {
+public:
+    virtual ~AlarmStorage() {}
+
+    virtual bool    exists(const char* path) = 0;
+    virtual bool    remove(const char* path) = 0;     ///< true also when it did not exist
+
+    // Reading (one file at a time)
+    virtual bool    openRead(const char* path) = 0;   ///< false if missing
+    virtual Stream& reader() = 0;                     ///< open file as a Stream (JSON import)
+    virtual size_t  read(uint8_t* data, size_t length) = 0;
+    virtual size_t  size() = 0;                       ///< size of the open file
+    virtual bool    seek(size_t position) = 0;
+    virtual void    closeRead() = 0;
+
+    // Writing (one file at a time): replaces the file, or extends it with append
+    virtual bool    openWrite(const char* path, bool append) = 0;
+    virtual size_t  write(const uint8_t* data, size_t length) = 0;
+    virtual Print&  writer() = 0;                     ///< open file as a Print (JSON export)
+    virtual bool    closeWrite() = 0;                 ///< false if the data could not be stored
+};
+
+/**
+ * @brief Backend on an Arduino file system (SPIFFS, LittleFS, FFat, SD)
+ * @note The file system must be mounted by the application.
+ */
+class FSAlarmStorage : public AlarmStorage {
+public:
+    explicit FSAlarmStorage(fs::FS& fileSystem) : _fs(fileSystem) {}
+
+    bool exists(const char* path) override { return _fs.exists(path); }
+    bool remove(const char* path) override { return !_fs.exists(path) || _fs.remove(path); }
+
+    bool openRead(const char* path) override {
+        // exists() first: opening a missing file logs an error on ESP32
+        if (!_fs.exists(path)) return false;
+        _read = _fs.open(path, "r");
+        return (bool)_read;
+    }
+    Stream& reader() override { return _read; }
+    size_t  read(uint8_t* data, size_t length) override { return _read.read(data, length); }
+    size_t  size() override { return _read.size(); }
+    bool    seek(size_t position) override { return _read.seek(position); }
+    void    closeRead() override { _read.close(); }
+
+    bool openWrite(const char* path, bool append) override {
+        _write = _fs.open(path, append ? "a" : "w");
+        return (bool)_write;
+    }
+    size_t write(const uint8_t* data, size_t length) override { return _write.write(data, length); }
+    Print& writer() override { return _write; }
+    bool   closeWrite() override {
+        _write.close();
+        return true;
+    }
+
+private:
+    fs::FS& _fs;
+    File    _read;
+    File    _write;
+};
+
+/**
+ * @brief Default backend: SPIFFS, mounted by the application
+ */
+class SPIFFSAlarmStorage : public FSAlarmStorage {
+public:
+    SPIFFSAlarmStorage() : FSAlarmStorage(SPIFFS) {}
+};
+
+/**
+ * @brief Growable heap buffer readable as a Stream and writable as a Print
+ */
+class AlarmBuffer : public Stream {
+public:
+    AlarmBuffer() {}
+    ~AlarmBuffer() { clear(); }
+
+    /// @brief Free the data and reset position and error state
+    void clear() {
+        free(_data);
+        _data = nullptr;
+        _size = _capacity = _pos = 0;
+        _failed = false;
+    }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t length) override {
+        if (_size + length > _capacity) {
+            size_t capacity = _capacity ? _capacity : 64;
+            while (capacity < _size + length) capacity *= 2;
+            uint8_t* grown = (uint8_t*)realloc(_data, capacity);
+            if (!grown) {
+                _failed = true;
+                return 0;
+            }
+            _data = grown;
+            _capacity = capacity;
+        }
+        memcpy(_data + _size, data, length);
+        _size += length;
+        return length;
+    }
+    using Print::write;
+
+    int    available() override { return (int)(_size - _pos); }
+    int    read() override { return _pos < _size ? _data[_pos++] : -1; }
+    int    peek() override { return _pos < _size ? _data[_pos] : -1; }
+    size_t read(uint8_t* data, size_t length) {
+        if (length > _size - _pos) length = _size - _pos;
+        memcpy(data, _data + _pos, length);
+        _pos += length;
+        return length;
+    }
+    size_t readBytes(char* data, size_t length) { return read((uint8_t*)data, length); }
+
+    /// @brief Replace the content with length bytes to fill in (nullptr if out of memory)
+    uint8_t* resize(size_t length) {
+        clear();
+        if (length == 0) return nullptr;
+        _data = (uint8_t*)malloc(length);
+        if (!_data) {
+            _failed = true;
+            return nullptr;
+        }
+        _size = _capacity = length;
+        return _data;
+    }
+
+    bool     seek(size_t position) {
+        if (position > _size) return false;
+        _pos = position;
+        return true;
+    }
+    size_t   size() const { return _size; }
+    uint8_t* data() { return _data; }
+    bool     failed() const { return _failed; }
+
+private:
+    uint8_t* _data = nullptr;
+    size_t   _size = 0;
+    size_t   _capacity = 0;
+    size_t   _pos = 0;
+    bool     _failed = false;       // an allocation failed while writing
+};
+
+/**
+ * @brief Base for backends that store whole blobs instead of files
+ *
+ * @details The file open for reading is loaded into a buffer; the file open
+ *          for writing is collected in another one (starting from the stored
+ *          content when appending) and stored in one go on closeWrite().
+ */
+class BufferedAlarmStorage : public AlarmStorage {
+public:
+    static constexpr size_t MAX_PATH = 32;
+
+    bool openRead(const char* path) override {
+        closeRead();
+        return _load(path, _read);
+    }
+    Stream& reader() override { return _read; }
+    size_t  read(uint8_t* data, size_t length) override { return _read.read(data, length); }
+    size_t  size() override { return _read.size(); }
+    bool    seek(size_t position) override { return _read.seek(position); }
+    void    closeRead() override { _read.clear(); }
+
+    bool openWrite(const char* path, bool append) override {
+        _write.clear();
+        strncpy(_writePath, path, MAX_PATH - 1);
+        _writePath[MAX_PATH - 1] = '\0';
+        if (append && exists(path)) {
+            return _load(path, _write);
+        }
+        return true;
+    }
+    size_t write(const uint8_t* data, size_t length) override { return _write.write(data, length); }
+    Print& writer() override { return _write; }
+    bool   closeWrite() override {
+        bool ok = !_write.failed() && _storeBlob(_writePath, _write.data(), _write.size());
+        _write.clear();
+        return ok;
+    }
+
+protected:
+    /// @brief Size of a stored blob (only called for existing paths)
+    virtual size_t _blobSize(const char* path) = 0;
+    /// @brief Copy a stored blob into data (length = _blobSize())
+    virtual size_t _loadBlob(const char* path, uint8_t* data, size_t length) = 0;
+    /// @brief Create or replace a blob
+    virtual bool   _storeBlob(const char* path, const uint8_t* data, size_t length) = 0;
+
+private:
+    bool _load(const char* path, AlarmBuffer& buffer) {
+        if (!exists(path)) return false;
+
+        size_t length = _blobSize(path);
+        uint8_t* data = buffer.resize(length);
+        if (length == 0) return true;
+        return data && _loadBlob(path, data, length) == length;
+    }
+
+    AlarmBuffer _read;
+    AlarmBuffer _write;
+    char        _writePath[MAX_PATH] = "";
+};
+
+#endif // ALARMSTORAGE_H
@@ -0,0 +1,36 @@
+/**
+ * @file AlarmStorageLittleFS.h
+ * @brief LittleFS backend for AlarmScheduler
+ *
+ * @details Included separately so that sketches not using LittleFS do not pull
+ *          it in. LittleFS appends in place and renames atomically, so journal
+ *          entries cost a fraction of a SPIFFS page rewrite.
+ *
+ * @code
+ * #include <AlarmStorageLittleFS.h>
+ * LittleFSAlarmStorage storage;
+ * LittleFS.begin(true);
+ * scheduler.setStorage(storage);
+ * scheduler.begin();
+ * @endcode
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ * @version 1.0.0
+ */
+
+#ifndef ALARMSTORAGELITTLEFS_H
+#define ALARMSTORAGELITTLEFS_H
+
+#include <LittleFS.h>
+#include "AlarmStorage.h"
+
+/**
+ * @brief Backend on LittleFS, mounted by the application
+ */
+class LittleFSAlarmStorage : public FSAlarmStorage {
+public:
+    LittleFSAlarmStorage() : FSAlarmStorage(LittleFS) {}
+};
+
+#endif // ALARMSTORAGELITTLEFS_H
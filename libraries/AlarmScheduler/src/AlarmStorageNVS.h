@@ -0,0 +1,109 @@
+/**
+ * @file AlarmStorageNVS.h
+ * @brief NVS (Preferences) backend for AlarmScheduler
+ *
+ * @details Each file is one blob in an NVS namespace. NVS keys are limited to
+ *          15 characters: short paths are used as the key without the leading
+ *          '/' (per-alarm records, "alarm_12"), longer ones as a hash. NVS
+ *          writes a blob whole: appending to the journal rewrites the journal
+ *          blob, which is still far smaller than the snapshot while it stays
+ *          below JOURNAL_COMPACT_BYTES. With setPersistence(PERSIST_PER_ALARM)
+ *          each alarm is its own small blob instead. No file system partition
+ *          is needed.
+ *
+ * @code
+ * #include <AlarmStorageNVS.h>
+ * NVSAlarmStorage storage("alarms");
+ * scheduler.setStorage(storage);
+ * scheduler.setPersistence(PERSIST_PER_ALARM);   // optional: one blob per alarm
+ * scheduler.begin();
+ * @endcode
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ * @version 1.0.0
+ */
+
+#ifndef ALARMSTORAGENVS_H
+#define ALARMSTORAGENVS_H
+
+#include <Preferences.h>
+#include "AlarmStorage.h"
+
+/**
+ * @brief Backend on NVS blobs through Preferences
+ */
+class NVSAlarmStorage : public BufferedAlarmStorage {
+public:
+    /**
+     * @param nvsNamespace NVS namespace (max 15 characters), kept by pointer
+     */
+    explicit NVSAlarmStorage(const char* nvsNamespace = "alarms") : _namespace(nvsNamespace) {}
+
+    bool exists(const char* path) override {
+        Preferences prefs;
+        if (!prefs.begin(_namespace, true)) return false;  // namespace not created yet
+        char key[16];
+        bool found = prefs.isKey(_key(path, key));
+        prefs.end();
+        return found;
+    }
+
+    bool remove(const char* path) override {
+        if (!exists(path)) return true;
+        Preferences prefs;
+        if (!prefs.begin(_namespace, false)) return false;
+        char key[16];
+        bool removed = prefs.remove(_key(path, key));
+        prefs.end();
+        return removed;
+    }
+
+protected:
+    size_t _blobSize(const char* path) override {
+        Preferences prefs;
+        if (!prefs.begin(_namespace, true)) return 0;
+        char key[16];
+        size_t length = prefs.getBytesLength(_key(path, key));
+        prefs.end();
+        return length;
+    }
+
+    size_t _loadBlob(const char* path, uint8_t* data, size_t length) override {
+        Preferences prefs;
+        if (!prefs.begin(_namespace, true)) return 0;
+        char key[16];
+        size_t read = prefs.getBytes(_key(path, key), data, length);
+        prefs.end();
+        return read;
+    }
+
+    bool _storeBlob(const char* path, const uint8_t* data, size_t length) override {
+        Preferences prefs;
+        if (!prefs.begin(_namespace, false)) return false;
+        char key[16];
+        bool stored = prefs.putBytes(_key(path, key), data, length) == length;
+        prefs.end();
+        return stored;
+    }
+
+private:
+    /// @brief NVS key for a path: the path without '/' if it fits, else "f" + FNV-1a hash in hex
+    static const char* _key(const char* path, char* key) {
+        if (*path == '/' && strlen(path + 1) <= 15) {
+            strcpy(key, path + 1);
+            return key;
+        }
+        
+        uint32_t hash = 2166136261UL;
+        while (*path) {
+            hash = (hash ^ (uint8_t)*path++) * 16777619UL;
+        }
+        snprintf(key, 16, "f%08lx", (unsigned long)hash);
+        return key;
+    }
+
+    const char* _namespace;
+};
+
+#endif // ALARMSTORAGENVS_H
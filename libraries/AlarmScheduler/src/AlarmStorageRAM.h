@@ -0,0 +1,108 @@
+/**
+ * @file AlarmStorageRAM.h
+ * @brief Volatile in-memory backend for AlarmScheduler
+ *
+ * @details Keeps every file in a heap buffer. Nothing survives a reset; meant
+ *          for host tests and for boards without flash storage to spare.
+ *
+ * @author Julian Salas Bartolomé
+ * @date 2025-11-29
+ * @version 1.0.0
+ */
+
+#ifndef ALARMSTORAGERAM_H
+#define ALARMSTORAGERAM_H
+
+#include "AlarmStorage.h"
+
+/**
+ * @brief Backend on RAM buffers
+ *
+ * @details The file table grows as needed: per-alarm persistence keeps one
+ *          file per alarm plus the index, so its size follows the capacity.
+ */
+class RAMAlarmStorage : public BufferedAlarmStorage {
+public:
+    ~RAMAlarmStorage() {
+        for (size_t i = 0; i < _fileSlots; i++) {
+            free(_files[i].data);
+        }
+        free(_files);
+    }
+
+    bool exists(const char* path) override { return _find(path) != nullptr; }
+
+    bool remove(const char* path) override {
+        Entry* file = _find(path);
+        if (file) {
+            free(file->data);
+            *file = Entry();
+        }
+        return true;
+    }
+
+protected:
+    size_t _blobSize(const char* path) override {
+        Entry* file = _find(path);
+        return file ? file->size : 0;
+    }
+
+    size_t _loadBlob(const char* path, uint8_t* data, size_t length) override {
+        Entry* file = _find(path);
+        if (!file) return 0;
+        if (length > file->size) length = file->size;
+        memcpy(data, file->data, length);
+        return length;
+    }
+
+    bool _storeBlob(const char* path, const uint8_t* data, size_t length) override {
+        Entry* file = _find(path);
+        if (!file) {
+            file = _find("");   // free entry
+            if (!file) file = _grow();
+            if (!file) return false;
+            strncpy(file->path, path, MAX_PATH - 1);
+            file->path[MAX_PATH - 1] = '\0';
+        }
+        uint8_t* copy = (uint8_t*)malloc(length ? length : 1);
+        if (!copy) return false;
+        memcpy(copy, data, length);
+        free(file->data);
+        file->data = copy;
+        file->size = length;
+        return true;
+    }
+
+private:
+    struct Entry {
+        char     path[MAX_PATH] = "";   // empty = free entry
+        uint8_t* data = nullptr;
+        size_t   size = 0;
+    };
+
+    Entry* _find(const char* path) {
+        for (size_t i = 0; i < _fileSlots; i++) {
+            if (strcmp(_files[i].path, path) == 0) return &_files[i];
+        }
+        return nullptr;
+    }
+
+    /// @brief Double the file table; returns the first new (free) entry
+    Entry* _grow() {
+        size_t slots = _fileSlots ? _fileSlots * 2 : 6;   // two snapshots, journal, JSON and spare
+        Entry* grown = (Entry*)realloc(_files, slots * sizeof(Entry));
+        if (!grown) return nullptr;
+        for (size_t i = _fileSlots; i < slots; i++) {
+            grown[i] = Entry();
+        }
+        _files = grown;
+        Entry* first = &_files[_fileSlots];
+        _fileSlots = slots;
+        return first;
+    }
+
+    Entry* _files = nullptr;
+    size_t _fileSlots = 0;
+};
+
+#endif // ALARMSTORAGERAM_H
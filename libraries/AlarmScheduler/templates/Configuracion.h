@@ -19,16 +19,25 @@
 // ============================================================================
 namespace Config {
     namespace Alarms {
-        // JSON persistence file path
+        // JSON import/export file path (alarms persist in the binary snapshots
+        // AlarmScheduler::BINARY_FILE / BINARY_FILE_B; this one is imported
+        // when neither is valid)
         const char JSON_FILE[] = "/customizable_alarms.json";
         
         // Load default alarms if JSON file doesn't exist
         const bool LOAD_DEFAULTS = true;
         
-        // Auto-save on modifications
+        // Auto-save on modifications (scheduler.setAutoSave): each change is
+        // appended to the journal; with false, changes are only written by
+        // scheduler.flush()
         const bool AUTO_SAVE = true;
         
-        // Maximum customizable alarms (system uses AlarmScheduler::MAX_ALARMS = 16)
+        // Quiet time after the last change before compacting the journal into
+        // a new snapshot
+        const uint32_t SAVE_DEBOUNCE_MS = 2000;
+        
+        // Maximum customizable alarms (table size is AlarmScheduler::MAX_ALARMS = 16,
+        // use BasicAlarmScheduler<N> for a different capacity)
         const uint8_t MAX_CUSTOMIZABLE = 10;
     }
 
@@ -46,24 +46,26 @@ class DebugHelper {
 public:
     /**
      * @brief Print alarm schedule summary
-     * @param scheduler Pointer to AlarmScheduler instance
+     * @param scheduler Pointer to AlarmScheduler (or BasicAlarmScheduler<N>) instance
      */
-    static void printAlarmSummary(class AlarmScheduler* scheduler) {
+    template <class Scheduler>
+    static void printAlarmSummary(Scheduler* scheduler) {
         if (!scheduler) return;
         
         Serial.println("\n========== ALARM SUMMARY ==========");
-        Serial.printf("Total alarms: %u\n", scheduler->count());
+        Serial.printf("Total alarms: %u\n", (unsigned)scheduler->count());
         
-        uint8_t enabled = 0, disabled = 0, customizable = 0;
-        for (uint8_t i = 0; i < scheduler->count(); i++) {
-            const Alarm* alarm = scheduler->get(i);
+        unsigned enabled = 0, disabled = 0, customizable = 0;
+        for (size_t i = 0; i < scheduler->slotEnd(); i++) {
+            const typename Scheduler::Alarm* alarm = scheduler->get(i);
+            if (!alarm) continue;   // deleted alarm
             if (alarm->enabled) enabled++;
             else disabled++;
-            if (alarm->isCustomizable) customizable++;
+            if (scheduler->getInfo(i)->isCustomizable) customizable++;
         }
         
         Serial.printf("Enabled: %u | Disabled: %u\n", enabled, disabled);
-        Serial.printf("Customizable: %u | System: %u\n", customizable, scheduler->count() - customizable);
+        Serial.printf("Customizable: %u | System: %u\n", customizable, (unsigned)scheduler->count() - customizable);
         Serial.println("===================================\n");
     }
     
@@ -0,0 +1,126 @@
+/**
+ * @file Arduino.h
+ * @brief Host stand-in for the parts of the Arduino core the library uses
+ *
+ * @details The clock is simulated: time() returns g_mockNow, millis() and
+ *          micros() return g_mockMillis / g_mockMicros, and delay() advances
+ *          g_mockMillis. Tests move them by hand.
+ */
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <string>
+#include <time.h>
+#include <sys/time.h>
+#include <algorithm>
+
+// ---- fake clock -----------------------------------------------------------
+extern time_t g_mockNow;          // epoch seconds
+extern uint32_t g_mockMillis;
+extern uint32_t g_mockMicros;
+extern long g_getLocalTimeCalls;
+extern void (*g_mockTimeHook)();  // runs inside time(), e.g. to edit mid-check()
+inline time_t mock_time(time_t* p) {
+    if (g_mockTimeHook) g_mockTimeHook();
+    if (p) *p = g_mockNow;
+    return g_mockNow;
+}
+inline int mock_gettimeofday(struct timeval* tv, void*) { tv->tv_sec = g_mockNow; tv->tv_usec = 0; return 0; }
+#define time(x) mock_time(x)
+#define gettimeofday(a,b) mock_gettimeofday(a,b)
+inline uint32_t millis() { return g_mockMillis; }
+inline uint32_t esp_random() { return 0x1234abcdu; }
+inline uint32_t micros() { return g_mockMicros; }
+inline void delay(uint32_t ms) { g_mockMillis += ms; }
+inline void yield() {}
+inline bool getLocalTime(struct tm* info, uint32_t ms = 5000) {
+    (void)ms; g_getLocalTimeCalls++;
+    time_t now = g_mockNow; if (now < 1451606400) return false;
+    localtime_r(&now, info); return true;
+}
+
+class String {
+public:
+    std::string s;
+    String() {}
+    String(const char* c) : s(c ? c : "") {}
+    String(const std::string& x) : s(x) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+    const char* c_str() const { return s.c_str(); }
+    size_t length() const { return s.size(); }
+    bool reserve(size_t n) { s.reserve(n); return true; }
+    bool concat(const char* c) { s += c; return true; }
+    bool concat(char c) { s += c; return true; }
+    bool concat(const char* c, size_t n) { s.append(c, n); return true; }
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    String& operator+=(const char* o) { s += o; return *this; }
+    String& operator+=(char o) { s += o; return *this; }
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator==(const char* o) const { return s == o; }
+    bool isEmpty() const { return s.empty(); }
+    char operator[](size_t i) const { return s[i]; }
+    void clear() { s.clear(); }
+};
+inline String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+inline String operator+(const char* a, const String& b) { return String(std::string(a) + b.s); }
+inline String operator+(const String& a, const char* b) { return String(a.s + b); }
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* b, size_t n) { size_t k = 0; while (n--) k += write(*b++); return k; }
+    size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t write(const char* s, size_t n) { return write((const uint8_t*)s, n); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(const String& s) { return write(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned v) { return printf("%u", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t println() { return write("\n"); }
+    template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[512]; va_list ap; va_start(ap, fmt); int n = vsnprintf(buf, sizeof(buf), fmt, ap); va_end(ap);
+        return write((const uint8_t*)buf, std::min<size_t>(n, sizeof(buf) - 1));
+    }
+};
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t readBytes(char* buf, size_t n) { size_t k = 0; while (k < n) { int c = read(); if (c < 0) break; buf[k++] = (char)c; } return k; }
+    bool find(const char* target) { return findUntil(target, nullptr); }
+    bool findUntil(const char* target, const char* term) {
+        size_t tl = strlen(target), ti = 0, ml = term ? strlen(term) : 0, mi = 0;
+        for (;;) { int c = read(); if (c < 0) return false;
+            if (c == target[ti]) { if (++ti == tl) return true; } else ti = (c == target[0]) ? 1 : 0;
+            if (ml) { if (c == term[mi]) { if (++mi == ml) return false; } else mi = (c == term[0]) ? 1 : 0; } }
+    }
+    String readString() { String r; int c; while ((c = read()) >= 0) r += (char)c; return r; }
+};
+class HardwareSerialMock : public Stream {
+public:
+    bool quiet = false;
+    size_t write(uint8_t c) override { if (!quiet) fputc(c, stdout); return 1; }
+    using Print::write;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    void begin(int) {}
+};
+extern HardwareSerialMock Serial;
+struct EspClass { uint32_t getFreeHeap() { return 100000; } uint32_t getMinFreeHeap() { return 90000; } };
+extern EspClass ESP;
+// FreeRTOS (syntax only)
+typedef void* TaskHandle_t;
+inline void vTaskDelay(uint32_t) {}
+inline int xTaskCreatePinnedToCore(void (*)(void*), const char*, uint32_t, void*, unsigned, TaskHandle_t*, int) { return 1; }
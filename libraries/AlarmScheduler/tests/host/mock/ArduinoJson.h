@@ -0,0 +1,207 @@
+/**
+ * @file ArduinoJson.h
+ * @brief Host stand-in for the subset of the ArduinoJson 7 API the library uses
+ *
+ * @details Enough to build and run the library on Linux without the real
+ *          library: documents, objects, arrays, filters, serialize/deserialize.
+ */
+#pragma once
+#include "Arduino.h"
+#include <memory>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+namespace ajmock {
+struct Node {
+    enum T { Null, Bool, Int, Float, Str, Arr, Obj } t = Null;
+    bool b = false; long long i = 0; double f = 0; std::string s;
+    std::vector<std::shared_ptr<Node>> arr;
+    std::vector<std::pair<std::string, std::shared_ptr<Node>>> obj;
+    std::shared_ptr<Node> find(const std::string& k) const { for (auto& p : obj) if (p.first == k) return p.second; return nullptr; }
+};
+}
+
+class JsonObject; class JsonArray;
+class JsonVariant {
+public:
+    std::shared_ptr<ajmock::Node> n;
+    std::shared_ptr<JsonVariant> parent; std::string key; long idx = -1;
+    JsonVariant() {}
+    explicit JsonVariant(std::shared_ptr<ajmock::Node> x) : n(x) {}
+    ajmock::Node* get() const {
+        if (n) return n.get();
+        if (!parent) return nullptr;
+        ajmock::Node* p = parent->get(); if (!p) return nullptr;
+        if (idx >= 0) return (p->t == ajmock::Node::Arr && (size_t)idx < p->arr.size()) ? p->arr[idx].get() : nullptr;
+        auto c = p->find(key); return c ? c.get() : nullptr;
+    }
+    ajmock::Node* ensure() {
+        if (n) return n.get();
+        ajmock::Node* p = parent->ensure();
+        if (idx >= 0) { if (p->t != ajmock::Node::Arr) { p->t = ajmock::Node::Arr; p->arr.clear(); }
+            while ((size_t)idx >= p->arr.size()) p->arr.push_back(std::make_shared<ajmock::Node>()); n = p->arr[idx]; return n.get(); }
+        if (p->t != ajmock::Node::Obj) { p->t = ajmock::Node::Obj; p->obj.clear(); }
+        auto c = p->find(key); if (!c) { c = std::make_shared<ajmock::Node>(); p->obj.push_back({key, c}); }
+        n = c; return n.get();
+    }
+    JsonVariant operator[](const char* k) const { JsonVariant v; v.parent = std::make_shared<JsonVariant>(*this); v.key = k; return v; }
+    JsonVariant operator[](const String& k) const { return (*this)[k.c_str()]; }
+    JsonVariant operator[](int i) const { JsonVariant v; v.parent = std::make_shared<JsonVariant>(*this); v.idx = i; return v; }
+    void setNode(const ajmock::Node& src) { *ensure() = src; }
+    template <typename T> typename std::enable_if<std::is_same<T,bool>::value, void>::type setv(T x) { auto* p = ensure(); *p = ajmock::Node(); p->t = ajmock::Node::Bool; p->b = x; }
+    template <typename T> typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value, void>::type setv(T x) { auto* p = ensure(); *p = ajmock::Node(); p->t = ajmock::Node::Int; p->i = (long long)x; }
+    template <typename T> typename std::enable_if<std::is_floating_point<T>::value, void>::type setv(T x) { auto* p = ensure(); *p = ajmock::Node(); p->t = ajmock::Node::Float; p->f = x; }
+    void setv(const char* x) { auto* p = ensure(); *p = ajmock::Node(); if (x) { p->t = ajmock::Node::Str; p->s = x; } }
+    void setv(char* x) { setv((const char*)x); }
+    void setv(const String& x) { setv(x.c_str()); }
+    void setv(const JsonVariant& x) { ajmock::Node* s = x.get(); if (s) setNode(*s); else { auto* p = ensure(); *p = ajmock::Node(); } }
+    template <typename T> JsonVariant& operator=(const T& x) { setv(x); return *this; }
+    JsonVariant& operator=(const JsonVariant& x) { if (this != &x) { if (!n && !parent) { n = x.n; parent = x.parent; key = x.key; idx = x.idx; } else setv(x); } return *this; }
+    JsonVariant(const JsonVariant&) = default;
+    template <size_t N> JsonVariant& operator=(const char (&x)[N]) { setv((const char*)x); return *this; }
+    template <size_t N> JsonVariant& operator=(char (&x)[N]) { setv((const char*)x); return *this; }
+    bool isNull() const { auto* p = get(); return !p || p->t == ajmock::Node::Null; }
+    template <typename T> T as() const;
+    template <typename T> bool is() const;
+    template <typename T> typename std::enable_if<std::is_arithmetic<T>::value, T>::type operator|(T d) const {
+        auto* p = get(); if (!p) return d;
+        if (std::is_same<T,bool>::value) return p->t == ajmock::Node::Bool ? (T)p->b : d;
+        if (p->t == ajmock::Node::Int) return (T)p->i; if (p->t == ajmock::Node::Float) return (T)p->f; return d; }
+    const char* operator|(const char* d) const { auto* p = get(); return (p && p->t == ajmock::Node::Str) ? p->s.c_str() : d; }
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    operator T() const { return as<T>(); }
+    operator const char*() const;
+    operator JsonArray() const; operator JsonObject() const;
+    JsonArray createNestedArray(const char* k) const; JsonObject createNestedObject(const char* k) const;
+    JsonObject createNestedObject() const;
+    template <typename T> T to(); template <typename T> T add();
+    template <typename T> bool add(const T& v);
+    size_t size() const { auto* p = get(); if (!p) return 0; return p->t == ajmock::Node::Arr ? p->arr.size() : p->t == ajmock::Node::Obj ? p->obj.size() : 0; }
+    bool containsKey(const char* k) const { auto* p = get(); return p && p->t == ajmock::Node::Obj && p->find(k); }
+};
+template <> inline const char* JsonVariant::as<const char*>() const { auto* p = get(); return (p && p->t == ajmock::Node::Str) ? p->s.c_str() : nullptr; }
+template <> inline String JsonVariant::as<String>() const { auto* p = get(); return (p && p->t == ajmock::Node::Str) ? String(p->s.c_str()) : String("null"); }
+inline JsonVariant::operator const char*() const { return as<const char*>(); }
+template <typename T> inline T JsonVariant::as() const { auto* p = get(); if (!p) return T(); if (p->t == ajmock::Node::Int) return (T)p->i; if (p->t == ajmock::Node::Float) return (T)p->f; if (p->t == ajmock::Node::Bool) return (T)p->b; return T(); }
+template <> inline bool JsonVariant::is<const char*>() const { auto* p = get(); return p && p->t == ajmock::Node::Str; }
+template <> inline bool JsonVariant::is<int>() const { auto* p = get(); return p && p->t == ajmock::Node::Int; }
+template <> inline bool JsonVariant::is<bool>() const { auto* p = get(); return p && p->t == ajmock::Node::Bool; }
+
+class JsonObject : public JsonVariant { public: JsonObject() {} JsonObject(const JsonVariant& v) : JsonVariant(v) {} using JsonVariant::operator=; };
+class JsonArray : public JsonVariant {
+public:
+    JsonArray() {} JsonArray(const JsonVariant& v) : JsonVariant(v) {}
+    struct iterator { const JsonArray* a; size_t i; bool operator!=(const iterator& o) const { return i != o.i; } void operator++() { ++i; } JsonVariant operator*() const { return JsonVariant(a->get()->arr[i]); } };
+    iterator begin() const { return iterator{this, 0}; }
+    iterator end() const { auto* p = get(); return iterator{this, (p && p->t == ajmock::Node::Arr) ? p->arr.size() : 0}; }
+};
+inline JsonVariant::operator JsonArray() const { return JsonArray(*this); }
+inline JsonVariant::operator JsonObject() const { return JsonObject(*this); }
+template <> inline JsonObject JsonVariant::as<JsonObject>() const { return JsonObject(*this); }
+template <> inline JsonArray JsonVariant::as<JsonArray>() const { return JsonArray(*this); }
+inline JsonArray JsonVariant::createNestedArray(const char* k) const { JsonVariant v = (*this)[k]; auto* p = v.ensure(); *p = ajmock::Node(); p->t = ajmock::Node::Arr; return JsonArray(v); }
+inline JsonObject JsonVariant::createNestedObject(const char* k) const { JsonVariant v = (*this)[k]; auto* p = v.ensure(); *p = ajmock::Node(); p->t = ajmock::Node::Obj; return JsonObject(v); }
+inline JsonObject JsonVariant::createNestedObject() const { JsonVariant self = *this; auto* p = self.ensure(); if (p->t != ajmock::Node::Arr) { *p = ajmock::Node(); p->t = ajmock::Node::Arr; } auto c = std::make_shared<ajmock::Node>(); c->t = ajmock::Node::Obj; p->arr.push_back(c); return JsonObject(JsonVariant(c)); }
+template <> inline JsonObject JsonVariant::to<JsonObject>() { auto* p = ensure(); *p = ajmock::Node(); p->t = ajmock::Node::Obj; return JsonObject(*this); }
+template <> inline JsonArray JsonVariant::to<JsonArray>() { auto* p = ensure(); *p = ajmock::Node(); p->t = ajmock::Node::Arr; return JsonArray(*this); }
+template <> inline JsonObject JsonVariant::add<JsonObject>() { return createNestedObject(); }
+template <typename T> inline bool JsonVariant::add(const T& v) { auto* p = ensure(); if (p->t != ajmock::Node::Arr) { *p = ajmock::Node(); p->t = ajmock::Node::Arr; } auto c = std::make_shared<ajmock::Node>(); p->arr.push_back(c); JsonVariant(c).setv(v); return true; }
+
+class JsonDocument : public JsonVariant {
+public:
+    JsonDocument() : JsonVariant(std::make_shared<ajmock::Node>()) {}
+    explicit JsonDocument(size_t) : JsonDocument() {}
+    JsonDocument(const JsonDocument&) = delete;
+    void clear() { *n = ajmock::Node(); }
+    template <typename T> JsonDocument& operator=(const T& x) { setv(x); return *this; }
+    bool overflowed() const { return false; }
+    size_t memoryUsage() const { return 0; }
+};
+typedef JsonDocument DynamicJsonDocument;
+template <size_t N> class StaticJsonDocument : public JsonDocument {};
+
+class DeserializationError {
+public:
+    enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory, TooDeep };
+    Code c;
+    DeserializationError(Code x = Ok) : c(x) {}
+    explicit operator bool() const { return c != Ok; }
+    bool operator==(Code x) const { return c == x; }
+    bool operator!=(Code x) const { return c != x; }
+    Code code() const { return c; }
+    const char* c_str() const { static const char* s[] = {"Ok","EmptyInput","IncompleteInput","InvalidInput","NoMemory","TooDeep"}; return s[c]; }
+};
+namespace DeserializationOption {
+struct Filter { const JsonVariant* f; explicit Filter(const JsonVariant& x) : f(&x) {} };
+struct NestingLimit { explicit NestingLimit(int) {} };
+}
+
+namespace ajmock {
+struct Reader {
+    virtual int peek() = 0; virtual int read() = 0; virtual ~Reader() {}
+    void ws() { int c; while ((c = peek()) == ' ' || c == '\n' || c == '\r' || c == '\t') read(); }
+};
+struct StrReader : Reader { const char* p; size_t n, i = 0; StrReader(const char* s, size_t l) : p(s), n(l) {} int peek() override { return i < n ? (unsigned char)p[i] : -1; } int read() override { return i < n ? (unsigned char)p[i++] : -1; } };
+struct StreamReader : Reader { Stream& s; StreamReader(Stream& x) : s(x) {} int peek() override { return s.peek(); } int read() override { return s.read(); } };
+inline bool parseStr(Reader& r, std::string& out) {
+    if (r.read() != '"') return false;
+    for (;;) { int c = r.read(); if (c < 0) return false; if (c == '"') return true;
+        if (c == '\\') { c = r.read(); if (c < 0) return false; if (c == 'n') c = '\n'; else if (c == 't') c = '\t'; else if (c == 'u') { char h[5] = {0}; for (int k = 0; k < 4; k++) h[k] = (char)r.read(); c = (int)strtol(h, nullptr, 16); if (c > 127) c = '?'; } }
+        out += (char)c; }
+}
+inline DeserializationError::Code parse(Reader& r, Node& n) {
+    r.ws(); int c = r.peek();
+    if (c < 0) return DeserializationError::IncompleteInput;
+    if (c == '{') { r.read(); n.t = Node::Obj; r.ws(); if (r.peek() == '}') { r.read(); return DeserializationError::Ok; }
+        for (;;) { r.ws(); std::string k; if (r.peek() < 0) return DeserializationError::IncompleteInput; if (!parseStr(r, k)) return r.peek() < 0 ? DeserializationError::IncompleteInput : DeserializationError::InvalidInput;
+            r.ws(); if (r.read() != ':') return DeserializationError::InvalidInput; auto v = std::make_shared<Node>();
+            auto e = parse(r, *v); if (e) return e; n.obj.push_back({k, v}); r.ws(); int d = r.read();
+            if (d == '}') return DeserializationError::Ok; if (d < 0) return DeserializationError::IncompleteInput; if (d != ',') return DeserializationError::InvalidInput; } }
+    if (c == '[') { r.read(); n.t = Node::Arr; r.ws(); if (r.peek() == ']') { r.read(); return DeserializationError::Ok; }
+        for (;;) { auto v = std::make_shared<Node>(); auto e = parse(r, *v); if (e) return e; n.arr.push_back(v); r.ws(); int d = r.read();
+            if (d == ']') return DeserializationError::Ok; if (d < 0) return DeserializationError::IncompleteInput; if (d != ',') return DeserializationError::InvalidInput; } }
+    if (c == '"') { n.t = Node::Str; return parseStr(r, n.s) ? DeserializationError::Ok : DeserializationError::IncompleteInput; }
+    std::string tok; while ((c = r.peek()) >= 0 && (isalnum(c) || c == '-' || c == '+' || c == '.')) tok += (char)r.read();
+    if (tok.empty()) return c < 0 ? DeserializationError::IncompleteInput : DeserializationError::InvalidInput;
+    if (tok == "true") { n.t = Node::Bool; n.b = true; } else if (tok == "false") { n.t = Node::Bool; n.b = false; } else if (tok == "null") { n.t = Node::Null; }
+    else if (tok.find_first_of(".eE") != std::string::npos) { n.t = Node::Float; n.f = atof(tok.c_str()); } else { n.t = Node::Int; n.i = atoll(tok.c_str()); }
+    return DeserializationError::Ok;
+}
+inline void applyFilter(Node& n, const Node* f) {
+    if (!f || (f->t == Node::Bool && f->b)) return;
+    if (f->t == Node::Obj && n.t == Node::Obj) { std::vector<std::pair<std::string, std::shared_ptr<Node>>> keep;
+        for (auto& p : n.obj) { auto fc = f->find(p.first); if (!fc) fc = f->find("*"); if (fc) { applyFilter(*p.second, fc.get()); keep.push_back(p); } } n.obj = keep; return; }
+    if (f->t == Node::Arr && n.t == Node::Arr && !f->arr.empty()) { for (auto& e : n.arr) applyFilter(*e, f->arr[0].get()); return; }
+    n = Node();
+}
+inline void emit(const Node& n, std::string& o) {
+    char buf[64];
+    switch (n.t) {
+    case Node::Null: o += "null"; break; case Node::Bool: o += n.b ? "true" : "false"; break;
+    case Node::Int: snprintf(buf, sizeof buf, "%lld", n.i); o += buf; break;
+    case Node::Float: snprintf(buf, sizeof buf, "%g", n.f); o += buf; break;
+    case Node::Str: o += '"'; for (char c : n.s) { if (c == '"' || c == '\\') o += '\\'; if (c == '\n') { o += "\\n"; continue; } o += c; } o += '"'; break;
+    case Node::Arr: o += '['; for (size_t i = 0; i < n.arr.size(); i++) { if (i) o += ','; emit(*n.arr[i], o); } o += ']'; break;
+    case Node::Obj: o += '{'; for (size_t i = 0; i < n.obj.size(); i++) { if (i) o += ','; o += '"'; o += n.obj[i].first; o += "\":"; emit(*n.obj[i].second, o); } o += '}'; break;
+    }
+}
+inline std::string dump(const JsonVariant& v) { std::string o; auto* p = v.get(); if (p) emit(*p, o); else o = "null"; return o; }
+}
+
+inline DeserializationError deserializeJsonImpl(JsonDocument& doc, ajmock::Reader& r, const JsonVariant* filter) {
+    doc.clear(); r.ws(); if (r.peek() < 0) return DeserializationError::EmptyInput;
+    auto e = ajmock::parse(r, *doc.n); if (e) { doc.clear(); return e; }
+    if (filter) ajmock::applyFilter(*doc.n, filter->get()); return DeserializationError::Ok;
+}
+inline DeserializationError deserializeJson(JsonDocument& d, const String& s) { ajmock::StrReader r(s.c_str(), s.length()); return deserializeJsonImpl(d, r, nullptr); }
+inline DeserializationError deserializeJson(JsonDocument& d, const char* s) { ajmock::StrReader r(s, strlen(s)); return deserializeJsonImpl(d, r, nullptr); }
+inline DeserializationError deserializeJson(JsonDocument& d, const char* s, size_t n) { ajmock::StrReader r(s, n); return deserializeJsonImpl(d, r, nullptr); }
+inline DeserializationError deserializeJson(JsonDocument& d, Stream& s) { ajmock::StreamReader r(s); return deserializeJsonImpl(d, r, nullptr); }
+inline DeserializationError deserializeJson(JsonDocument& d, Stream& s, DeserializationOption::Filter f) { ajmock::StreamReader r(s); return deserializeJsonImpl(d, r, f.f); }
+inline DeserializationError deserializeJson(JsonDocument& d, const String& s, DeserializationOption::Filter f) { ajmock::StrReader r(s.c_str(), s.length()); return deserializeJsonImpl(d, r, f.f); }
+
+inline size_t serializeJson(const JsonVariant& v, String& out) { out = String(ajmock::dump(v)); return out.length(); }
+inline size_t serializeJson(const JsonVariant& v, Print& out) { std::string s = ajmock::dump(v); return out.write((const uint8_t*)s.data(), s.size()); }
+inline size_t serializeJson(const JsonVariant& v, char* buf, size_t n) { std::string s = ajmock::dump(v); size_t k = std::min(s.size(), n ? n - 1 : 0); memcpy(buf, s.data(), k); if (n) buf[k] = 0; return k; }
+inline size_t measureJson(const JsonVariant& v) { return ajmock::dump(v).size(); }
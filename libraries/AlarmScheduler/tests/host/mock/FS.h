@@ -0,0 +1,66 @@
+/**
+ * @file FS.h
+ * @brief In-memory file system with a write budget for power-cut tests
+ *
+ * @details g_writeBudget bytes may still be written (-1 = unlimited); a write
+ *          past it is cut short, as if the power failed mid-write.
+ */
+#pragma once
+#include "Arduino.h"
+#include <map>
+#include <memory>
+#include <vector>
+namespace fs {
+extern long g_openWrites;
+extern long g_writeBudget; // bytes allowed to be written before "power cut" (-1 = unlimited)
+struct FileData { std::vector<uint8_t> bytes; };
+class File : public Stream {
+public:
+    std::shared_ptr<FileData> d; size_t pos = 0; bool wr = false;
+    File() {}
+    File(std::shared_ptr<FileData> x, bool w, size_t p) : d(x), pos(p), wr(w) {}
+    explicit operator bool() const { return (bool)d; }
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* b, size_t n) override {
+        if (!d || !wr) return 0;
+        size_t k = 0;
+        while (k < n) { if (g_writeBudget == 0) break; if (g_writeBudget > 0) g_writeBudget--;
+            if (pos < d->bytes.size()) d->bytes[pos] = b[k]; else d->bytes.push_back(b[k]); pos++; k++; }
+        return k; }
+    using Print::write;
+    int available() override { return d ? (int)(d->bytes.size() - pos) : 0; }
+    int read() override { if (!d || pos >= d->bytes.size()) return -1; return d->bytes[pos++]; }
+    int peek() override { if (!d || pos >= d->bytes.size()) return -1; return d->bytes[pos]; }
+    size_t read(uint8_t* b, size_t n) { size_t k = 0; while (k < n && pos < d->bytes.size()) b[k++] = d->bytes[pos++]; return k; }
+    bool seek(size_t p) { if (!d || p > d->bytes.size()) return false; pos = p; return true; }
+    size_t position() const { return pos; }
+    size_t size() const { return d ? d->bytes.size() : 0; }
+    void flush() {}
+    void close() { d.reset(); }
+    const char* name() const { return "f"; }
+    bool isDirectory() { return false; }
+    File openNextFile() { return File(); }
+};
+class FS {
+public:
+    std::map<std::string, std::shared_ptr<FileData>> files;
+    bool begin(bool = false) { return true; }
+    bool exists(const char* p) { return files.count(p) > 0; }
+    bool exists(const String& p) { return exists(p.c_str()); }
+    bool remove(const char* p) { return files.erase(p) > 0; }
+    bool rename(const char* a, const char* b) { auto it = files.find(a); if (it == files.end()) return false; files[b] = it->second; files.erase(a); return true; }
+    File open(const char* p, const char* mode = "r") {
+        std::string m(mode);
+        if (m == "r") { auto it = files.find(p); if (it == files.end()) return File(); return File(it->second, false, 0); }
+        if (m == "w" || m == "a") g_openWrites++;
+        if (m == "w") { auto d = std::make_shared<FileData>(); files[p] = d; return File(d, true, 0); }
+        if (m == "a") { auto& d = files[p]; if (!d) d = std::make_shared<FileData>(); return File(d, true, d->bytes.size()); }
+        if (m == "r+") { auto it = files.find(p); if (it == files.end()) return File(); return File(it->second, true, 0); }
+        return File();
+    }
+    File open(const String& p, const char* mode = "r") { return open(p.c_str(), mode); }
+    size_t totalBytes() { return 1 << 20; }
+    size_t usedBytes() { return 0; }
+};
+}
+using fs::File;
@@ -0,0 +1,8 @@
+/**
+ * @file SPIFFS.h
+ * @brief SPIFFS instance of the in-memory file system
+ */
+#pragma once
+#include "FS.h"
+class SPIFFSFS : public fs::FS {};
+extern SPIFFSFS SPIFFS;
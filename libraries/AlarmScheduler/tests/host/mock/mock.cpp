@@ -0,0 +1,22 @@
+/**
+ * @file mock.cpp
+ * @brief Globals of the host mocks (clock, Serial, SPIFFS)
+ */
+
+#include "Arduino.h"
+#include "SPIFFS.h"
+
+void (*g_mockTimeHook)() = nullptr;
+time_t   g_mockNow = 0;
+uint32_t g_mockMillis = 0;
+uint32_t g_mockMicros = 0;
+long     g_getLocalTimeCalls = 0;
+
+HardwareSerialMock Serial;
+EspClass ESP;
+SPIFFSFS SPIFFS;
+
+namespace fs {
+long g_writeBudget = -1;
+long g_openWrites = 0;
+}
@@ -0,0 +1,51 @@
+#!/bin/sh
+# Builds and runs the host tests against the mocks in mock/ (Arduino core,
+# SPIFFS, ArduinoJson subset), with AddressSanitizer and UBSan.
+#
+#   ./run_tests.sh                 all test_*.cpp
+#   ./run_tests.sh test_wakeups    only the named tests
+#
+# A test with "// variant: <flags>" lines is also built once per line with
+# those flags added, e.g. a configuration macro that must reach every file.
+#
+# CXX and CXXFLAGS override the compiler and flags; OUT the build directory.
+set -e
+HERE=$(cd "$(dirname "$0")" && pwd)
+SRC="$HERE/../../src"
+OUT="${OUT:-${TMPDIR:-/tmp}/alarmscheduler-host-tests}"
+CXX="${CXX:-g++}"
+CXXFLAGS="${CXXFLAGS:--std=gnu++11 -g -O1 -Wall -fsanitize=address,undefined}"
+
+mkdir -p "$OUT"
+tests="$*"
+if [ -z "$tests" ]; then
+    tests=$(cd "$HERE" && ls test_*.cpp | sed 's/\.cpp$//')
+fi
+
+failed=0
+
+# Builds and runs one test; $2 holds extra compiler flags and names the binary
+run() {
+    name="$1${2:+ $2}"
+    bin="$OUT/$1$(echo "$2" | tr -c 'A-Za-z0-9_\n' '_')"
+    printf '%s: ' "$name"
+    $CXX $CXXFLAGS $2 -isystem "$HERE/mock" -I"$SRC" "$HERE/mock/mock.cpp" "$SRC"/*.cpp \
+        "$HERE/$1.cpp" -o "$bin" -lpthread
+    if "$bin" > "$bin.log" 2>&1; then
+        tail -n 1 "$bin.log"
+    else
+        echo "FAILED"
+        cat "$bin.log"
+        failed=1
+    fi
+}
+
+for t in $tests; do
+    run "$t" ""
+    # Read from a file, not a pipe, so run() can still set $failed
+    sed -n 's|^// variant: ||p' "$HERE/$t.cpp" > "$OUT/$t.variants"
+    while read -r flags; do
+        run "$t" "$flags"
+    done < "$OUT/$t.variants"
+done
+exit $failed
@@ -0,0 +1,48 @@
+/**
+ * @file test_check_overlap.cpp
+ * @brief An edit that starts while check() collects the due alarms
+ *
+ * @details The time() hook edits the alarm from inside check(), after its
+ *          first sequence test, as another task could. check() must drop the
+ *          tick and repeat it on the next call, firing once with the new data.
+ */
+
+#include <AlarmScheduler.h>
+#include <cassert>
+
+static AlarmScheduler s;
+static int fires = 0;
+static int lastParam = -1;
+
+static void cb(uint16_t p) {
+    fires++;
+    lastParam = p;
+}
+
+static void editNow() {
+    g_mockTimeHook = nullptr;
+    s.modifyCustomizable(1, "A", "", DOW_ALL, 8, 0, "T", true, cb, 2);
+}
+
+int main() {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    SPIFFS.begin(true);
+    g_mockNow = 1767225600 + 8 * 3600 - 30;     // 07:59:30
+    s.begin(false);
+    s.setAutoSave(false);
+    s.addCustomizable("A", "", DOW_ALL, 8, 0, "T", 1, cb, true);
+    s.check();
+
+    g_mockNow += 30;                            // 08:00:00
+    g_mockTimeHook = editNow;
+    s.check();
+    assert(fires == 0 && s.msUntilNextDue() == 0);
+
+    s.check();
+    printf("fires=%d param=%d\n", fires, lastParam);
+    assert(fires == 1 && lastParam == 2);
+    s.check();
+    assert(fires == 1);
+    puts("OK");
+}
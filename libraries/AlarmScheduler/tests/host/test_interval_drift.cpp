@@ -0,0 +1,119 @@
+/**
+ * @file test_interval_drift.cpp
+ * @brief 30 simulated days of interval alarms on the wall-clock grid
+ *
+ * @details check() runs every 1-7 s (pseudo-random), with an occasional
+ *          resetCache(), for 30 days in three time zones (no DST, a spring and
+ *          an autumn change). Every interval alarm must fire on exactly the
+ *          wall-clock minutes anchor + k * interval of each of its days (the
+ *          grid restarts every day) that exist locally - none missing, none off
+ *          the grid, none repeated except in a minute whose execution cache
+ *          resetCache() cleared - and within one polling step of the minute
+ *          boundary, so lateness never adds up.
+ */
+
+#include <AlarmScheduler.h>
+#include <cassert>
+#include <set>
+#include <vector>
+
+struct IntervalCase {
+    uint8_t  dayMask;
+    uint8_t  hour;
+    uint8_t  minute;
+    uint16_t intervalMin;
+};
+
+static const IntervalCase CASES[] = {
+    { DOW_ALL,                 ALARM_WILDCARD, 0, 15 },
+    { DOW_ALL,                 7,             10, 90 },
+    { DOW_LUNES | DOW_JUEVES,  0,              3,  7 },   // 1440 % 7 != 0: short last step
+    { DOW_ALL,                 9,             30, 100 },  // 09:30 daily although 1440 % 100 != 0
+};
+static const int NUM_CASES = sizeof(CASES) / sizeof(CASES[0]);
+
+static std::vector<time_t> fires[NUM_CASES];
+
+static void cb(uint16_t p) { fires[p].push_back(g_mockNow); }
+
+/// @brief Local wall-clock minute as a continuous index (DST offset removed)
+static long wallMinute(time_t when, struct tm* local) {
+    localtime_r(&when, local);
+    struct tm wall = *local;
+    wall.tm_sec = 0;
+    wall.tm_isdst = 0;
+    return (long)(timegm(&wall) / 60);
+}
+
+static bool onGrid(int p, const struct tm& local) {
+    const IntervalCase& c = CASES[p];
+    long anchor = (c.hour == ALARM_WILDCARD ? 0 : c.hour) * 60 + c.minute;
+    long minute = local.tm_hour * 60 + local.tm_min;
+    long phase = ((minute - anchor) % c.intervalMin + c.intervalMin) % c.intervalMin;
+    return (c.dayMask & (1 << local.tm_wday)) && phase == 0;
+}
+
+static void run(const char* tz, time_t start) {
+    setenv("TZ", tz, 1);
+    tzset();
+    for (int p = 0; p < NUM_CASES; p++) fires[p].clear();
+
+    AlarmScheduler s;
+    g_mockNow = start;
+    s.begin(false);
+    for (int p = 0; p < NUM_CASES; p++) {
+        const IntervalCase& c = CASES[p];
+        s.addExternal(c.dayMask, c.hour, c.minute, c.intervalMin, cb, p, true);
+    }
+
+    const time_t end = start + 30 * 86400;
+    unsigned seed = 3;
+    std::set<long> resetMinutes;
+    while (g_mockNow < end) {
+        s.check();
+        seed = seed * 1103515245 + 12345;
+        g_mockNow += 1 + (seed >> 16) % 7;
+        if ((seed >> 8) % 50000 == 0) {
+            s.resetCache();
+            struct tm local;
+            resetMinutes.insert(wallMinute(g_mockNow, &local));
+        }
+    }
+
+    // Every grid minute between the first and last full minute of the run
+    for (int p = 0; p < NUM_CASES; p++) {
+        std::set<long> expected, fired;
+        for (time_t t = start + 60 - start % 60; t + 60 <= end - 60; t += 60) {
+            struct tm local;
+            long minute = wallMinute(t, &local);
+            if (onGrid(p, local)) expected.insert(minute);
+        }
+        long maxLag = 0;
+        for (time_t f : fires[p]) {
+            struct tm local;
+            long minute = wallMinute(f, &local);
+            assert(onGrid(p, local));                          // off the grid
+            if (!fired.insert(minute).second) {
+                // resetCache() forgets what ran this minute; the phase is what must survive
+                assert(resetMinutes.count(minute));
+                continue;
+            }
+            if (local.tm_sec > maxLag) maxLag = local.tm_sec;
+        }
+        for (long minute : expected) {
+            assert(fired.count(minute));                      // missed
+        }
+        assert(maxLag <= 6);                                  // one polling step at most
+        printf("%s alarm %d: fires=%zu maxLagSec=%ld\n", tz, p, fires[p].size(), maxLag);
+    }
+    printf("%s resets=%zu\n", tz, resetMinutes.size());
+}
+
+int main() {
+    setvbuf(stdout, nullptr, _IONBF, 0);
+    SPIFFS.begin(true);
+    run("UTC0", 1767225600);                              // 2026-01-01
+    run("CET-1CEST,M3.5.0,M10.5.0/3", 1773532800);        // 2026-03-15, DST starts on 2026-03-29
+    run("EST5EDT,M3.2.0,M11.1.0", 1792454400);            // 2026-10-20, DST ends on 2026-11-01
+    puts("OK");
+}
@@ -0,0 +1,103 @@
+/**
+ * @file test_matcher_bench.cpp
+ * @brief check() with 500 wildcard alarms against a linear-scan reference
+ *
+ * @details One simulated day (Monday, UTC) of check() calls every second, with
+ *          half the alarms every hour at a given minute and half every minute
+ *          of a given hour on Mondays and Fridays. A plain scan of all alarms
+ *          each second (day, hour and minute match, once per minute) gives the
+ *          expected fires; the scheduler must fire exactly the same alarms in
+ *          the same seconds. Both times are printed. run_tests.sh builds it a
+ *          second time with the bit-sliced matcher (variant line below).
+ */
+// variant: -DALARMSCHEDULER_BITSLICED
+
+#include <AlarmScheduler.h>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+typedef std::vector<std::pair<time_t, uint16_t>> FireLog;
+
+static const uint16_t NUM_ALARMS = 500;
+static const time_t   START_TIME = 1767571200;    // Monday 2026-01-05 00:00:00 UTC
+
+struct Spec {
+    uint8_t dayMask;
+    uint8_t hour;
+    uint8_t minute;
+};
+
+static FireLog fired;
+
+static void onAlarm(uint16_t param) { fired.push_back(std::make_pair(g_mockNow, param)); }
+
+static Spec spec(uint16_t i) {
+    // Half every hour at a given minute, half every minute of a given hour
+    if (i % 2) return Spec{DOW_ALL, ALARM_WILDCARD, (uint8_t)(i % 60)};
+    return Spec{DOW_LUNES | DOW_VIERNES, (uint8_t)((i / 2) % 24), ALARM_WILDCARD};
+}
+
+/// @brief The expected fires: every alarm tested every second, once per minute
+static FireLog linearScan(double& seconds) {
+    FireLog log;
+    std::vector<long> lastMinute(NUM_ALARMS, -1);
+    auto t0 = std::chrono::steady_clock::now();
+    for (time_t now = START_TIME; now < START_TIME + 86400; now++) {
+        struct tm local;
+        localtime_r(&now, &local);
+        long minute = (long)(now / 60);
+        for (uint16_t i = 0; i < NUM_ALARMS; i++) {
+            Spec s = spec(i);
+            bool match = (s.dayMask & (1 << local.tm_wday)) &&
+                         (s.hour == ALARM_WILDCARD || s.hour == local.tm_hour) &&
+                         (s.minute == ALARM_WILDCARD || s.minute == local.tm_min);
+            if (match && lastMinute[i] != minute) {
+                lastMinute[i] = minute;
+                log.push_back(std::make_pair(now, i));
+            }
+        }
+    }
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    return log;
+}
+
+int main() {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    SPIFFS.begin(true);
+
+    static BasicAlarmScheduler<512, uint16_t> scheduler;
+    g_mockNow = START_TIME;
+    scheduler.begin(false);
+    for (uint16_t i = 0; i < NUM_ALARMS; i++) {
+        Spec s = spec(i);
+        scheduler.addExternal(s.dayMask, s.hour, s.minute, 0, onAlarm, i, true);
+    }
+    assert(scheduler.count() == NUM_ALARMS);
+
+    double checkSeconds = 0;
+    for (g_mockNow = START_TIME; g_mockNow < START_TIME + 86400; g_mockNow++) {
+        auto t0 = std::chrono::steady_clock::now();
+        scheduler.check();
+        checkSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    double scanSeconds = 0;
+    FireLog expected = linearScan(scanSeconds);
+    std::sort(fired.begin(), fired.end());
+    std::sort(expected.begin(), expected.end());
+
+#ifdef ALARMSCHEDULER_BITSLICED
+    printf("backend: bit-sliced matcher\n");
+#else
+    printf("backend: next-fire heap\n");
+#endif
+    printf("fires=%zu expected=%zu\n", fired.size(), expected.size());
+    printf("check(): %.1f ms per simulated day, linear scan: %.1f ms\n", checkSeconds * 1000,
+           scanSeconds * 1000);
+    assert(!expected.empty() && fired == expected);
+    puts("OK");
+}
@@ -0,0 +1,185 @@
+/**
+ * @file test_seqlock_stress.cpp
+ * @brief JSON readers on other threads while check() applies posted edits
+ *
+ * @details One thread posts adds, modifies, enables and deletes; one thread
+ *          runs check(), which applies them; two threads export the list (and
+ *          share its cache) and one the delta feed and the statistics. Each
+ *          customizable alarm encodes its parameter in every field, so a torn
+ *          read shows up as an element whose fields disagree. SECS sets the run
+ *          time (default 3 s).
+ */
+
+#include <AlarmScheduler.h>
+#include <atomic>
+#include <cassert>
+#include <csignal>
+#include <sched.h>
+#include <sys/time.h>
+#include <thread>
+
+static void cb(uint16_t) {}
+
+struct Sink : Print {
+    String& text;
+    explicit Sink(String& s) : text(s) {}
+    size_t write(uint8_t c) override {
+        text += (char)c;
+        return 1;
+    }
+};
+
+static AlarmScheduler s;
+static std::atomic<bool> stop{false};
+static std::atomic<long> torn{0}, reads{0}, edits{0}, ticks{0};
+
+static void names(uint16_t p, char* name, char* desc) {
+    // Lengths vary with p, so every edit moves the arena
+    int n = 1 + p % 7;
+    int k = sprintf(name, "N%u", p);
+    for (int i = 0; i < n; i++) name[k++] = 'x';
+    name[k] = 0;
+    k = sprintf(desc, "D%u", p);
+    for (int i = 0; i < 3 * n; i++) desc[k++] = 'y';
+    desc[k] = 0;
+}
+
+static bool validElement(JsonObject a) {
+    uint16_t p = a["parameter"] | 0;
+    char name[40], desc[80];
+    names(p, name, desc);
+    return strcmp(a["name"] | "", name) == 0 && strcmp(a["description"] | "", desc) == 0 &&
+           (a["hour"] | 99) == p % 24 && (a["minute"] | 99) == p % 60;
+}
+
+static void checkList(const char* json, bool whole) {
+    JsonDocument doc;
+    if (deserializeJson(doc, json)) {
+        torn++;
+        return;
+    }
+    JsonArray arr = doc["alarms"].as<JsonArray>();
+    for (JsonObject a : arr) {
+        if (!validElement(a)) torn++;
+    }
+    if (whole && (size_t)(doc["total"] | -1) != arr.size()) torn++;
+    reads++;
+}
+
+static void edit(uint32_t r) {
+    char name[40], desc[80];
+    uint16_t p = (r >> 8) % 1000;
+    int id = 1 + (r >> 20) % 12;
+    names(p, name, desc);
+    // Posted: check() applies them on the ticker thread
+    bool posted;
+    switch ((r >> 4) % 6) {
+        case 0:
+            posted = s.postDeleteCustomizable(id);
+            break;
+        case 1:
+            posted = s.postEnableCustomizable(id, (r >> 3) & 1);
+            break;
+        case 2:
+            posted = s.postAddCustomizable(name, desc, DOW_ALL, p % 24, p % 60, "T", p, cb, true);
+            break;
+        default:
+            posted = s.postModifyCustomizable(id, name, desc, DOW_ALL, p % 24, p % 60, "T", true,
+                                              cb, p);
+            break;
+    }
+    if (posted) {
+        edits++;
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+static void listReader() {
+    while (!stop) {
+        char etag[AlarmScheduler::ETAG_SIZE];
+        s.getETag(etag, sizeof(etag));
+        if (etag[0] != '"' || etag[strlen(etag) - 1] != '"') torn++;
+        checkList(s.getCustomizablesJSON().c_str(), true);
+        String out;
+        Sink sink(out);
+        s.getCustomizablesJSON(sink);
+        checkList(out.c_str(), false);
+    }
+}
+
+static void deltaReader() {
+    uint32_t since = 0;
+    while (!stop) {
+        String changes = s.getChangesJSON(since);
+        JsonDocument doc;
+        if (deserializeJson(doc, changes)) {
+            torn++;
+            continue;
+        }
+        for (JsonObject a : doc["changed"].as<JsonArray>()) {
+            if (!validElement(a)) torn++;
+        }
+        since = doc["dataVersion"] | 0;
+
+        JsonDocument st;
+        deserializeJson(st, s.getStatisticsJSON());
+        int total = st["totalAlarms"] | -1;
+        if ((st["system"] | 0) + (st["customizable"] | 0) != total ||
+            (st["enabled"] | 0) + (st["disabled"] | 0) != total || (st["system"] | 0) != 1) {
+            torn++;
+        }
+        reads++;
+    }
+}
+
+// One core here: a fast timer that yields in its handler preempts the
+// threads at arbitrary points, inside the short copy windows too
+static void preempt(int) { sched_yield(); }
+
+int main() {
+    signal(SIGALRM, preempt);
+    itimerval tick = {{0, 20}, {0, 20}};
+    setitimer(ITIMER_REAL, &tick, nullptr);
+    SPIFFS.begin(true);
+    s.begin(false);
+    s.setAutoSave(false);
+    s.addExternal(DOW_ALL, 3, 0, 0, cb, 0);
+    char name[40], desc[80];
+    for (uint16_t p = 0; p < 10; p++) {
+        names(p, name, desc);
+        s.addCustomizable(name, desc, DOW_ALL, p % 24, p % 60, "T", p, cb, true);
+    }
+
+    std::thread writer([] {
+        uint32_t r = 1;
+        while (!stop) {
+            r = r * 1103515245 + 12345;
+            edit(r);
+        }
+    });
+    std::thread ticker([] {
+        while (!stop) {
+            s.check();
+            ticks++;
+        }
+    });
+    std::thread lists(listReader), lists2(listReader);
+    std::thread deltas(deltaReader);
+
+    std::this_thread::sleep_for(std::chrono::seconds(getenv("SECS") ? atoi(getenv("SECS")) : 3));
+    stop = true;
+    itimerval off = {};
+    setitimer(ITIMER_REAL, &off, nullptr);
+    writer.join();
+    ticker.join();
+    lists.join();
+    lists2.join();
+    deltas.join();
+
+    setvbuf(stdout, nullptr, _IONBF, 0);
+    printf("edits=%ld reads=%ld ticks=%ld torn=%ld\n", edits.load(), reads.load(), ticks.load(),
+           torn.load());
+    assert(torn == 0 && reads > 100 && edits > 100);
+    puts("OK");
+}
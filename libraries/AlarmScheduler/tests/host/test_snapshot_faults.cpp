@@ -0,0 +1,163 @@
+/**
+ * @file test_snapshot_faults.cpp
+ * @brief Power cut at every byte offset of an A/B snapshot write
+ *
+ * @details The mock file system stops writing after g_writeBudget bytes. For
+ *          k = 0, 1, 2 ... the write of the next snapshot is cut after k bytes
+ *          and the board is "rebooted": the alarms loaded must be exactly the
+ *          ones of the previous snapshot, until k is large enough for the write
+ *          to complete and the new ones load. Three rounds alternate slots A
+ *          and B; each round also cuts a compaction (snapshot written while a
+ *          journal exists) at every byte, and once between the snapshot write
+ *          and the journal removal: the old journal must not be replayed on the
+ *          new snapshot.
+ */
+
+#include <AlarmScheduler.h>
+#include <cassert>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+static void cb(uint16_t) {}
+
+typedef std::map<std::string, std::vector<uint8_t>> Image;
+
+static Image snap() {
+    Image image;
+    for (auto& kv : SPIFFS.files) image[kv.first] = kv.second->bytes;
+    return image;
+}
+
+static void restore(const Image& image) {
+    SPIFFS.files.clear();
+    for (auto& kv : image) {
+        auto data = std::make_shared<fs::FileData>();
+        data->bytes = kv.second;
+        SPIFFS.files[kv.first] = data;
+    }
+}
+
+static std::string state(AlarmScheduler& s) {
+    std::string r;
+    for (int i = 0; i < s.slotEnd(); i++) {
+        if (!s.get(i)) continue;
+        char line[200];
+        snprintf(line, sizeof(line), "%d:%s:%s:%u:%u:%u:%d:%u|", s.getInfo(i)->webId, s.getName(i),
+                 s.getDescription(i), s.get(i)->dayMask, s.get(i)->hour, s.get(i)->minute,
+                 s.get(i)->enabled, s.get(i)->parameter);
+        r += line;
+    }
+    return r;
+}
+
+/// @brief The one snapshot slot that differs from the image
+static std::string writtenSlot(const Image& image) {
+    std::string written;
+    for (const char* slot : {"/customizable_alarms.bin", "/customizable_alarms_b.bin"}) {
+        bool changed = SPIFFS.exists(slot) &&
+                       (!image.count(slot) || SPIFFS.files[slot]->bytes != image.at(slot));
+        if (changed) {
+            assert(written.empty());
+            written = slot;
+        }
+    }
+    assert(!written.empty());
+    return written;
+}
+
+static std::string boot() {
+    AlarmScheduler r;
+    r.begin(false);
+    return state(r);
+}
+
+/// @brief Compaction cut at every byte: snapshot + journal always equals RAM
+static void compactionCuts(int round, long& trials, std::set<std::string>& slotsWritten) {
+    AlarmScheduler r;
+    r.begin(false);
+    r.modificarPersonalizable(r.getInfo(2)->webId, "Journal", "entry", DOW_MARTES, 7, round, "J",
+                              true, cb, 1);
+    assert(SPIFFS.exists("/customizable_alarms.log"));
+    std::string full = state(r);
+    Image base = snap();
+    for (long k = 0;; k++) {
+        restore(base);
+        AlarmScheduler q;
+        q.begin(false);
+        // Only in RAM until the snapshot: a replayed old journal would undo it
+        q.setAutoSave(false);
+        q.modificarPersonalizable(q.getInfo(2)->webId, "Snapshot", "only", DOW_MARTES, 8, round,
+                                  "J", true, cb, 2);
+        std::string saved = state(q);
+        fs::g_writeBudget = k;
+        bool ok = q.flush();
+        fs::g_writeBudget = -1;
+        assert(boot() == (ok ? saved : full));
+        trials++;
+        if (ok) {
+            slotsWritten.insert(writtenSlot(base));
+            // Cut after the snapshot closed but before the journal was removed
+            Image written = snap();
+            written["/customizable_alarms.log"] = base.at("/customizable_alarms.log");
+            restore(written);
+            assert(boot() == saved);
+            restore(written);
+            AlarmScheduler after;
+            after.begin(false);
+            after.eliminarPersonalizable(after.getInfo(2)->webId);
+            std::string deleted = state(after);
+            assert(boot() == deleted);
+            restore(written);
+            break;
+        }
+    }
+}
+
+int main() {
+    SPIFFS.begin(true);
+    AlarmScheduler s;
+    s.begin(false);
+    for (int i = 0; i < 6; i++) {
+        s.addPersonalizable("Bell", "morning bell", DOW_ALL, 8, i, "BELL", i, cb, true);
+    }
+    assert(s.flush());
+
+    long trials = 0;
+    std::set<std::string> slotsWritten;
+    for (int round = 0; round < 3; round++) {
+        // Snapshot write cut at every byte (auto-save off: edits only in RAM)
+        std::string before = state(s);
+        Image image = snap();
+        s.setAutoSave(false);
+        s.modificarPersonalizable(s.getInfo(1)->webId, "Changed", "x", DOW_LUNES, 9, round, "B",
+                                  false, cb, 9);
+        s.eliminarPersonalizable(s.getInfo(0)->webId);
+        std::string after = state(s);
+
+        for (long k = 0;; k++) {
+            restore(image);
+            fs::g_writeBudget = k;
+            bool ok = s.saveCustomizables();
+            fs::g_writeBudget = -1;
+            std::string got = boot();
+            trials++;
+            if (ok) {
+                assert(got == after);
+                slotsWritten.insert(writtenSlot(image));
+                break;
+            }
+            if (got != before) {
+                printf("round %d cut at %ld: bad state\n", round, k);
+                return 1;
+            }
+        }
+        s.setAutoSave(true);
+
+        compactionCuts(round, trials, slotsWritten);
+        s.begin(false);
+    }
+    assert(slotsWritten.size() == 2);     // A and B take turns
+    printf("trials=%ld\nOK\n", trials);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file test_wakeups.cpp
+ * @brief Wake-ups per simulated day: 1 s polling against msUntilNextDue()
+ *
+ * @details Runs the alarm set of examples/BasicAlarms, plus a few fixed-time
+ *          alarms, for 9 days over a DST change, twice: once calling check()
+ *          every second and once sleeping for msUntilNextDue() between calls.
+ *          Both runs must fire the same callbacks at the same seconds; the
+ *          tickless run may only wake for the minutes that fire something. An
+ *          edit posted from another task must end the sleep: the notify hook
+ *          runs and msUntilNextDue() is 0 until check() applies it.
+ */
+
+#include <AlarmScheduler.h>
+#include <cassert>
+#include <set>
+#include <string>
+
+static std::string logs[2];
+static std::set<time_t> fireTimes;
+static int mode;
+
+static void cb(uint16_t p) {
+    logs[mode] += std::to_string((long)g_mockNow) + " " + std::to_string(p) + "\n";
+    fireTimes.insert(g_mockNow);
+}
+static void cb0() { cb(0); }
+
+static int notified;
+static void onPost() { notified++; }
+static void onBell(uint16_t) {}
+
+static void setup(AlarmScheduler& s) {
+    // examples/BasicAlarms
+    s.addExternal(DOW_ALL, 8, 0, 0, cb, 10, true);
+    s.addExternal(DOW_ALL, 20, 0, 0, cb, 5, true);
+    s.addExternal0(DOW_ALL, ALARM_WILDCARD, 0, 0, cb0, true);
+    s.addExternal(DOW_MONDAY | DOW_FRIDAY, 12, 0, 0, cb, 1, true);
+    s.addExternal(DOW_ALL, ALARM_WILDCARD, 0, 15, cb, 42, true);
+    s.addExternal(DOW_SATURDAY | DOW_SUNDAY, 9, 30, 0, cb, 15, true);
+    // Inside the skipped DST hour, at midnight and on the last minute of the day
+    s.addExternal(DOW_ALL, 2, 30, 0, cb, 2, true);
+    s.addExternal(DOW_ALL, 0, 0, 0, cb, 3, true);
+    s.addExternal(DOW_ALL, 23, 59, 0, cb, 4, true);
+}
+
+int main() {
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+    SPIFFS.begin(true);
+
+    const int days = 9;
+    const time_t start = 1774224000;         // Mon 2026-03-23 00:00 UTC; DST starts on the 29th
+    long wakes[2] = {0, 0};
+
+    for (mode = 0; mode < 2; mode++) {
+        AlarmScheduler s;
+        g_mockNow = start;
+        s.begin(false);
+        setup(s);
+        while (g_mockNow < start + days * 86400) {
+            s.check();
+            wakes[mode]++;
+            if (mode == 0) {
+                g_mockNow++;
+                continue;
+            }
+            uint32_t ms = s.msUntilNextDue();
+            g_mockNow += (ms == 0) ? 1 : (ms + 999) / 1000;
+        }
+    }
+
+    int lines = 0;
+    for (char c : logs[0]) lines += (c == '\n');
+    printf("fires=%d distinct=%zu\n", lines, fireTimes.size());
+    printf("1s poll wakeups/day = %ld\n", wakes[0] / days);
+    printf("tickless wakeups/day = %ld\n", wakes[1] / days);
+
+    assert(lines > 0 && logs[0] == logs[1]);
+    assert(wakes[0] == days * 86400L);
+    // One wake per firing second, plus the first call and one per day for the plan
+    assert(wakes[1] <= (long)fireTimes.size() + 1 + days);
+
+    AlarmScheduler s;
+    g_mockNow = start;
+    s.begin(false);
+    s.setCommandNotify(onPost);
+    AlarmScheduler::Index idx = s.addCustomizable("Bell", "", DOW_ALL, 8, 0, "BELL", 1, onBell, true);
+    s.check();
+    assert(s.msUntilNextDue() > 0);
+    assert(s.postEnableCustomizable(s.getInfo(idx)->webId, false));
+    assert(notified == 1 && s.msUntilNextDue() == 0);
+    s.check();
+    assert(!s.get(idx)->enabled && s.msUntilNextDue() > 0);
+    puts("OK");
+}